@@ -23,55 +23,177 @@
  */
 
 #include <stddef.h>
+#include <string.h>
 #include "ms5611.h"
+#include "ms5611_variant.h"
+#include "ms5611_heat.h"
 
 #define MS5611_DEFAULT_OSR          (MS5611_ULTRA_HIGH_RES)
 
-/* MS5611 Has only 5 basic commands: */
+#ifndef MS5611_PROM_RETRY
+#define MS5611_PROM_RETRY   3   /* PROM reads before a suspicious PROM is reported */
+#endif
+
+/* Plausible C1..C6 window, 0.4x .. 2x of the datasheet example, never 0 or 0xFFFF (stuck bus) */
+static const uint16_t promRange[6][2] = {
+    {16000, 65534},
+    {14000, 65534},
+    { 9000, 47000},
+    { 9000, 47000},
+    {13000, 65534},
+    {11000, 57000},
+};
+
+static const uint8_t osrToConversitonTime [] = {
+    [MS5611_ULTRA_LOW_POWER] = 1,
+    [MS5611_LOW_POWER]  = 2,
+    [MS5611_STANDARD]   = 3,
+    [MS5611_HIGH_RES]   = 5,
+    [MS5611_ULTRA_HIGH_RES] = 10,
+};
+
+/* Transport binding */
+
+#ifdef MS5611_STATIC_INTF
+#include MS5611_STATIC_INTF
+
+#define MS5611_IO_READ(dev, in, reg, p, n)      MS5611_STATIC_READ((in), (reg), (p), (n))
+#define MS5611_IO_WRITE(dev, in, reg, p, n)     MS5611_STATIC_WRITE((in), (reg), (p), (n))
+#define MS5611_IO_DELAY(dev, ms)                MS5611_STATIC_DELAY(ms)
+
+#ifdef MS5611_STATIC_WRITEREAD
+#define MS5611_IO_HAS_WRITEREAD(dev)            1
+#define MS5611_IO_WRITEREAD(dev, in, t, tn, r, rn)  MS5611_STATIC_WRITEREAD((in), (t), (tn), (r), (rn))
+#else
+#define MS5611_IO_HAS_WRITEREAD(dev)            0
+#define MS5611_IO_WRITEREAD(dev, in, t, tn, r, rn)  ((void)(in), (void)(t), (void)(r), (int8_t)MS5611_ERROR)
+#endif
+
+#ifdef MS5611_STATIC_TRANSFER
+#define MS5611_IO_HAS_TRANSFER(dev)             1
+#define MS5611_IO_TRANSFER(dev, in, t, r, n)    MS5611_STATIC_TRANSFER((in), (t), (r), (n))
+#else
+#define MS5611_IO_HAS_TRANSFER(dev)             0
+#define MS5611_IO_TRANSFER(dev, in, t, r, n)    ((void)(in), (void)(t), (void)(r), (int8_t)MS5611_ERROR)
+#endif
+
+#ifdef MS5611_STATIC_SUBMIT
+#define MS5611_IO_HAS_SUBMIT(dev)               1
+#define MS5611_IO_SUBMIT(dev, x, n)             MS5611_STATIC_SUBMIT((dev)->intf, (x), (n))
+#else
+#define MS5611_IO_HAS_SUBMIT(dev)               0
+#define MS5611_IO_SUBMIT(dev, x, n)             ((void)(x), (int8_t)MS5611_ERROR)
+#endif
+
+#ifdef MS5611_STATIC_TIMESTAMP
+#define MS5611_IO_HAS_TIMESTAMP(dev)            1
+#define MS5611_IO_TIMESTAMP(dev)                MS5611_STATIC_TIMESTAMP((dev)->intf)
+#else
+#define MS5611_IO_HAS_TIMESTAMP(dev)            0
+#define MS5611_IO_TIMESTAMP(dev)                ((void)(dev), 0U)
+#endif
+
+#else
+
+#define MS5611_IO_READ(dev, in, reg, p, n)      (dev)->ops->read((in), (reg), (p), (n))
+#define MS5611_IO_WRITE(dev, in, reg, p, n)     (dev)->ops->write((in), (reg), (p), (n))
+#define MS5611_IO_DELAY(dev, ms)                (dev)->ops->delay(ms)
+#define MS5611_IO_HAS_WRITEREAD(dev)            ((dev)->ops->writeRead != NULL)
+#define MS5611_IO_WRITEREAD(dev, in, t, tn, r, rn)  (dev)->ops->writeRead((in), (t), (tn), (r), (rn))
+#define MS5611_IO_HAS_TRANSFER(dev)             ((dev)->ops->transfer != NULL)
+#define MS5611_IO_TRANSFER(dev, in, t, r, n)    (dev)->ops->transfer((in), (t), (r), (n))
+#define MS5611_IO_HAS_SUBMIT(dev)               ((dev)->ops->submit != NULL)
+#define MS5611_IO_SUBMIT(dev, x, n)             (dev)->ops->submit((dev)->intf, (x), (n))
+#define MS5611_IO_HAS_TIMESTAMP(dev)            ((dev)->ops->timestamp != NULL)
+#define MS5611_IO_TIMESTAMP(dev)                (dev)->ops->timestamp((dev)->intf)
+
+#endif /* MS5611_STATIC_INTF */
+
+/* Command transactions on an explicit interface instance : dev->intf, or a transfer list target */
+static int8_t MS5611_CmdRead(const MS5611_Device_t* dev, void* intf, uint8_t cmd, uint8_t* pRxData, uint8_t len){
+#ifdef MS5611_STATIC_INTF
+    (void)dev;
+#endif
+    if (MS5611_IO_HAS_TRANSFER(dev))
+    {
+        /* SPI : command and response clocked in one CS frame */
+        uint8_t tx[MS5611_SPI_FRAME_MAX] = {cmd};
+        uint8_t rx[MS5611_SPI_FRAME_MAX];
+        int8_t rslt;
+
+        if (len >= MS5611_SPI_FRAME_MAX) return MS5611_ERROR;
+        rslt = MS5611_IO_TRANSFER(dev, intf, tx, rx, len + 1);
+        for (uint8_t i = 0; i < len; i++) pRxData[i] = rx[i + 1];
+        return rslt;
+    }
+    if (MS5611_IO_HAS_WRITEREAD(dev)) return MS5611_IO_WRITEREAD(dev, intf, &cmd, 1, pRxData, len);
+    return MS5611_IO_READ(dev, intf, cmd, pRxData, len);
+}
 
-#define MS5611_CMD_RESET          	0x1E    /* Reset */
-#define MS5611_CMD_READ_PROM       	0xA0    /* PROM (128 bit of calibration words) */
-#define MS5611_CMD_CONV_D1         	0x40    /* D1 Conversion */
-#define MS5611_CMD_CONV_D2        	0x50    /* D2 Conversion */
-#define MS5611_CMD_ADC_READ      	0x00    /* Read ADC Result of the conversion (24 bit pressure / temperature) */
+static int8_t MS5611_CmdWrite(const MS5611_Device_t* dev, void* intf, uint8_t cmd){
+#ifdef MS5611_STATIC_INTF
+    (void)dev;
+#endif
+    if (MS5611_IO_HAS_TRANSFER(dev))
+    {
+        uint8_t rx;
+        return MS5611_IO_TRANSFER(dev, intf, &cmd, &rx, 1);
+    }
+    return MS5611_IO_WRITE(dev, intf, cmd, NULL, 0);
+}
 
-MS5611_Device_t MS5611_NewDevice(void* intf, MS5611_Intf_e intf_type, MS5611_Read_t readf, MS5611_Write_t writef, MS5611_Delay_t delayf)
+static void MS5611_CacheD2(MS5611_Device_t* dev, uint32_t D2){
+#ifndef MS5611_NO_D2_CACHE
+    dev->D2 = D2;
+    dev->D2Stamp = MS5611_Timestamp(dev);
+#else
+    (void)dev;
+    (void)D2;
+#endif
+}
+
+MS5611_Device_t MS5611_NewDevice(void* intf, const MS5611_Ops_t* ops)
 {
     MS5611_Device_t dev = {
         .intf = intf,
-        .intf_type = intf_type,
-        .read = readf,
-        .write = writef,
-        .delay = delayf
+#ifndef MS5611_STATIC_INTF
+        .ops = ops,
+#endif
     };
+#ifdef MS5611_STATIC_INTF
+    (void)ops;
+#endif
     return dev;
 }
 
 int8_t MS5611_Init(MS5611_Device_t* dev){
     MS5611_Reset(dev);
     MS5611_SetOSRate(dev, MS5611_DEFAULT_OSR);
+#ifndef MS5611_MINIMAL
     MS5611_InitConstants(dev, 0);
-    dev->delay(20);
+#endif
+    MS5611_IO_DELAY(dev, MS5611_RESET_MS);
     return MS5611_PROM(dev);
 }
 
 int8_t MS5611_Test(MS5611_Device_t* dev){
 	uint8_t temp;
-    return dev->read(dev->intf, MS5611_CMD_READ_PROM, &temp, 1);
+    return MS5611_CmdRead(dev, dev->intf, MS5611_CMD_READ_PROM, &temp, 1);
 }
 
 void MS5611_Reset(MS5611_Device_t* dev){
-    dev->write(dev->intf, MS5611_CMD_RESET, NULL, 0);
+    MS5611_CmdWrite(dev, dev->intf, MS5611_CMD_RESET);
 }
 
+#ifndef MS5611_MINIMAL
 void   MS5611_InitConstants(MS5611_Device_t* dev, int8_t mathMode)
 {
 	dev->config.C[0] = 1;
 
-	dev->config.C[1] = 32768L;          	/* Pressure sensitivity    : SENSt1     = C[1] * 2^15 */
-	dev->config.C[2] = 65536L;          	/* Pressure offset         : OFFt1      = C[2] * 2^16 */
-	dev->config.C[3] = 3.90625E-3;      	/* Temperature coef. of C1 : TCS        = C[3] / 2^8  */
-	dev->config.C[4] = 7.8125E-3;       	/* Temperature coef. of C2 : TCO        = C[4] / 2^7  */
+	dev->config.C[1] = (float)(1UL << V_SENS_SH);       	/* Pressure sensitivity    : SENSt1     = C[1] * 2^15 */
+	dev->config.C[2] = (float)(1UL << V_OFF_SH);        	/* Pressure offset         : OFFt1      = C[2] * 2^16 */
+	dev->config.C[3] = 1.0f / (float)(1UL << V_TCS_SH); 	/* Temperature coef. of C1 : TCS        = C[3] / 2^8  */
+	dev->config.C[4] = 1.0f / (float)(1UL << V_TCO_SH); 	/* Temperature coef. of C2 : TCO        = C[4] / 2^7  */
 	dev->config.C[5] = 256;             	/* Reference temperature   : Tref       = C[5] * 2^8  */
 	dev->config.C[6] = 1.1920928955E-7; 	/* Temperature coefficient : TEMPSENS   = C[6] / 2^23 */
 
@@ -83,37 +205,120 @@ void   MS5611_InitConstants(MS5611_Device_t* dev, int8_t mathMode)
 		dev->config.C[4] = 1.5625e-2;
 	}
 }
+#endif
 
 int8_t MS5611_PROM(MS5611_Device_t* dev){
 
-    int8_t rslt = MS5611_OK;
+    int8_t rslt = MS5611_ERROR;
+    uint8_t have = 0;
+    MS5611_PromRecord_t rec = {{0}}, prev;
 
-    for (uint8_t reg = 0; reg < 7; reg++)
+    /*
+     * Whole PROM burst as one transfer list. A record failing the check is
+     * read again : a different record is bus noise and is retried, the same
+     * record twice is the real content and is reported.
+     */
+    for (uint8_t i = 0; i < MS5611_PROM_RETRY; i++)
     {
-      uint16_t tmp = MS5611_ReadPROM(dev, reg);
-      dev->config.C[reg] *= tmp;
+        if (MS5611_PromDump(dev, &rec) != MS5611_OK) continue;
+        if (MS5611_PromCheck(&rec) == 0)
+        {
+            rslt = MS5611_OK;
+            break;
+        }
+        if (have && (memcmp(&rec, &prev, sizeof(rec)) == 0)) break;
+        prev = rec;
+        have = 1;
+    }
 
-      if ((reg > 0) && (tmp == 0)) rslt = MS5611_ERROR;
+    for (uint8_t reg = MS5611_PROM_FIRST; reg < 7; reg++)
+    {
+      dev->config.prom[reg - MS5611_PROM_FIRST] = rec.word[reg];
+#ifndef MS5611_MINIMAL
+      dev->config.C[reg] *= rec.word[reg];
+#endif
     }
+#ifndef MS5611_MINIMAL
+    MS5611_Precompute(dev);
+#endif
+    return rslt;
+}
+
+uint8_t MS5611_PromCrc(const MS5611_PromRecord_t* pRec){
+    uint16_t w[8];
+    uint16_t rem = 0;
+
+    memcpy(w, pRec->word, sizeof(w));
+#if V_CRC_W0
+    w[0] &= 0x0FFF;
+    w[7] = 0;
+#else
+    w[7] &= 0xFF00;
+#endif
+    /* AN520 : CRC-4, polynomial 0x3 over the 16 bytes, MSB first */
+    for (uint8_t cnt = 0; cnt < 16; cnt++)
+    {
+        rem ^= (cnt & 1) ? (w[cnt >> 1] & 0x00FF) : (w[cnt >> 1] >> 8);
+        for (uint8_t bit = 8; bit > 0; bit--)
+        {
+            rem = (rem & 0x8000) ? (uint16_t)((rem << 1) ^ 0x3000) : (uint16_t)(rem << 1);
+        }
+    }
+    return (uint8_t)((rem >> 12) & 0x0F);
+}
+
+uint8_t MS5611_PromCheck(const MS5611_PromRecord_t* pRec){
+    uint8_t flags = 0;
+#if V_CRC_W0
+    uint8_t crc = (uint8_t)(pRec->word[0] >> 12);
+#else
+    uint8_t crc = (uint8_t)(pRec->word[7] & 0x0F);
+#endif
+
+    if (MS5611_PromCrc(pRec) != crc) flags |= MS5611_PROM_CRC;
+    for (uint8_t c = 0; c < 6; c++)
+    {
+        if ((pRec->word[c + 1] < promRange[c][0]) || (pRec->word[c + 1] > promRange[c][1])) flags |= MS5611_PROM_RANGE;
+    }
+    return flags;
+}
+
+#ifndef MS5611_MINIMAL
+void MS5611_Precompute(MS5611_Device_t* dev){
+    dev->config.F[0] = dev->config.C[1] * 1.4551915228E-11f;   /* SENSt1 / 2^36 */
+    dev->config.F[1] = dev->config.C[3] * 1.4551915228E-11f;   /* TCS    / 2^36 */
+    dev->config.F[2] = dev->config.C[2] * 3.0517578125E-5f;    /* OFFt1  / 2^15 */
+    dev->config.F[3] = dev->config.C[4] * 3.0517578125E-5f;    /* TCO    / 2^15 */
+}
+#endif
+
+int8_t MS5611_PromDump(MS5611_Device_t* dev, MS5611_PromRecord_t* pRec){
+
+    int8_t rslt;
+    uint8_t raw[8][2];
+    MS5611_Xfer_t xfer[8];
+
+    for (uint8_t reg = 0; reg < 8; reg++)
+    {
+        xfer[reg].intf = NULL;
+        xfer[reg].cmd = MS5611_CMD_READ_PROM + (reg * 2);
+        xfer[reg].pRxData = raw[reg];
+        xfer[reg].len = 2;
+    }
+    rslt = MS5611_Submit(dev, xfer, 8);
+
+    for (uint8_t reg = 0; reg < 8; reg++) pRec->word[reg] = (raw[reg][0] << 8) | raw[reg][1];
     return rslt;
 }
 
 uint16_t MS5611_ReadPROM(MS5611_Device_t* dev, uint8_t reg){
 	uint8_t temp[2];
 	uint8_t mem = (MS5611_CMD_READ_PROM + (reg * 2)); /* 0xA0 to 0xAE 6 coefficient */
-    dev->read(dev->intf, mem, temp, 2);
+    MS5611_CmdRead(dev, dev->intf, mem, temp, 2);
     return (temp[0] << 8) | temp[1];
 }
 
 void MS5611_SetOSRate(MS5611_Device_t* dev, MS5611_OSRate_t osr){
-
-    const uint8_t osrToConversitonTime [] = {
-        [MS5611_ULTRA_LOW_POWER] = 1,
-        [MS5611_LOW_POWER]  = 2,
-        [MS5611_STANDARD]   = 3,
-        [MS5611_HIGH_RES]   = 5,
-        [MS5611_ULTRA_HIGH_RES] = 10,
-    };
 	dev->config.ct =  osrToConversitonTime[osr];
     dev->config.osRate = osr;
 }
@@ -122,69 +327,320 @@ MS5611_OSRate_t MS5611_GetOSRate(MS5611_Device_t* dev){
 	return dev->config.osRate;
 }
 
-int8_t MS5611_GetData(MS5611_Device_t* dev, float* pTemp, float* pPress){
+/* Convert / wait / read of D1 then D2 (skipped when pD2 is NULL), D2 cached on success */
+static int8_t MS5611_Acquire(MS5611_Device_t* dev, uint32_t* pD1, uint32_t* pD2){
 
-	int8_t rslt = MS5611_OK;
-    uint32_t D1, D2;
+    int8_t rslt = MS5611_OK;
 
     MS5611_Convert(dev, MS5611_CMD_CONV_D1);
-    dev->delay(dev->config.ct);
-    rslt |= MS5611_AdcRead(dev, &D1);
+    MS5611_IO_DELAY(dev, dev->config.ct);
+    rslt |= MS5611_AdcRead(dev, pD1);
+    if (pD2 == NULL) return rslt;
 
     MS5611_Convert(dev, MS5611_CMD_CONV_D2);
-    dev->delay(dev->config.ct);
-    rslt |= MS5611_AdcRead(dev, &D2);
+    MS5611_IO_DELAY(dev, dev->config.ct);
+    rslt |= MS5611_AdcRead(dev, pD2);
+    if (rslt == MS5611_OK) MS5611_CacheD2(dev, *pD2);
+    return rslt;
+}
+
+/* Output representations of this build */
+static int8_t MS5611_FormatCheck(MS5611_Format_t fmt){
+#ifdef MS5611_MINIMAL
+    if (fmt == MS5611_FMT_FLOAT) return MS5611_ERROR;
+#endif
+    return (fmt <= MS5611_FMT_FLOAT) ? MS5611_OK : MS5611_ERROR;
+}
+
+/* Compensation of a full D1 + D2 sample, self heating correction (MS5611_HEAT), output format */
+static int8_t MS5611_Output(MS5611_Device_t* dev, uint32_t D1, uint32_t D2, MS5611_Format_t fmt, MS5611_Output_t* pOut){
+#ifdef MS5611_HEAT
+    if (dev->heat != NULL)
+    {
+        MS5611_Data_t data = MS5611_RawDataProcess(dev, D1, D2, 1);
+        MS5611_HEAT_HOOK(dev, &data, MS5611_Timestamp(dev), 2);
+        return MS5611_Format(&data, fmt, pOut);
+    }
+#endif
+    return MS5611_RawDataProcessAs(dev, D1, D2, 1, fmt, pOut);
+}
+
+#ifndef MS5611_MINIMAL
+int8_t MS5611_GetData(MS5611_Device_t* dev, float* pTemp, float* pPress){
+
+    MS5611_Output_t out;
+    uint32_t D1, D2;
+    int8_t rslt = MS5611_Acquire(dev, &D1, &D2);
+
+    /* Same path as MS5611_GetDataAs(MS5611_FMT_FLOAT) */
+    rslt |= MS5611_Output(dev, D1, D2, MS5611_FMT_FLOAT, &out);
+    *pTemp = out.temperature.f;
+    *pPress = out.pressure.f;
+    return rslt;
+}
+#endif
+
+int8_t MS5611_GetDataAs(MS5611_Device_t* dev, MS5611_Format_t fmt, MS5611_Output_t* pOut){
 
-    MS5611_Data_t data = MS5611_RawDataProcess(dev, D1, D2, 1);
-	*pTemp = (float)data.temperature / 100.0f;
-	*pPress = (float)data.pressure / 100.0f;
+    uint32_t D1, D2;
+    int8_t rslt;
+
+    if (MS5611_FormatCheck(fmt) != MS5611_OK) return MS5611_ERROR;
+    rslt = MS5611_Acquire(dev, &D1, &D2);
+    rslt |= MS5611_Output(dev, D1, D2, fmt, pOut);
+    return rslt;
+}
+
+int8_t MS5611_GetDataBy(MS5611_Device_t* dev, uint32_t deadline, MS5611_OSRate_t minOsr, MS5611_Data_t* pData, MS5611_OSRate_t* pOsr){
+
+    int8_t rslt;
+    int8_t fresh = -1;
+    MS5611_OSRate_t osr = MS5611_ULTRA_HIGH_RES;
+    MS5611_OSRate_t saved = dev->config.osRate;
+#ifndef MS5611_NO_D2_CACHE
+    uint32_t D1, D2 = dev->D2;
+    uint8_t cached = (D2 != 0) && MS5611_IO_HAS_TIMESTAMP(dev) &&
+                     (MS5611_Timestamp(dev) - dev->D2Stamp <= MS5611_D2_MAX_AGE * 1000UL);
+#else
+    uint32_t D1, D2 = 0;
+    uint8_t cached = 0;
+#endif
+
+    /* Highest OSR that fits : full D1 + D2 cycle, or D1 only on a recent cached D2 */
+    for (;;)
+    {
+        uint32_t ct = osrToConversitonTime[osr] + MS5611_BUS_MS;
+        if (2 * ct <= deadline) { fresh = 1; break; }
+        if (cached && ct <= deadline) { fresh = 0; break; }
+        if (osr <= minOsr) break;
+        osr--;
+    }
+    if (fresh < 0) return MS5611_ERROR;
+
+    MS5611_SetOSRate(dev, osr);
+    rslt = MS5611_Acquire(dev, &D1, fresh ? &D2 : NULL);
+    MS5611_SetOSRate(dev, saved);
+
+    *pData = MS5611_RawDataProcess(dev, D1, D2, 1);
+    MS5611_HEAT_HOOK(dev, pData, MS5611_Timestamp(dev), fresh ? 2 : 1);
+    if (pOsr != NULL) *pOsr = osr;
+    return rslt;
+}
+
+#ifndef MS5611_NO_POLL
+/* Extra tick before an MS5611_Poll ADC read, 'now' may be late in its tick */
+#define MS5611_POLL_MARGIN  1
+
+enum{
+    MS5611_POLL_IDLE = 0,
+    MS5611_POLL_D1,
+    MS5611_POLL_D2
+};
 
-	return rslt;
+int8_t MS5611_Poll(MS5611_Device_t* dev, uint32_t now){
+
+    int8_t rslt = MS5611_BUSY;
+    uint32_t D2;
+
+    if (dev->state != MS5611_POLL_IDLE && (int32_t)(now - dev->due) < 0) return MS5611_BUSY;
+
+    switch (dev->state)
+    {
+    case MS5611_POLL_D1:
+        if (MS5611_AdcRead(dev, &dev->D1) != MS5611_OK)
+        {
+            dev->state = MS5611_POLL_IDLE;
+            return MS5611_ERROR;
+        }
+        MS5611_Convert(dev, MS5611_CMD_CONV_D2);
+        dev->state = MS5611_POLL_D2;
+        dev->due = now + dev->config.ct + MS5611_POLL_MARGIN;
+        return MS5611_BUSY;
+
+    case MS5611_POLL_D2:
+        if (MS5611_AdcRead(dev, &D2) != MS5611_OK)
+        {
+            dev->state = MS5611_POLL_IDLE;
+            return MS5611_ERROR;
+        }
+        MS5611_CacheD2(dev, D2);
+        dev->data = MS5611_RawDataProcess(dev, dev->D1, D2, 1);
+        MS5611_HEAT_HOOK(dev, &dev->data, MS5611_Timestamp(dev), 2);
+        rslt = MS5611_OK;
+        break;
+
+    default:
+        break;
+    }
+
+    /* Start the next cycle right away */
+    MS5611_Convert(dev, MS5611_CMD_CONV_D1);
+    dev->state = MS5611_POLL_D1;
+    dev->due = now + dev->config.ct + MS5611_POLL_MARGIN;
+    return rslt;
 }
+#endif
 
 void MS5611_Convert(MS5611_Device_t* dev, const uint8_t addr){
 	uint8_t cmd_convert = addr + (dev->config.osRate * 2);
-    dev->write(dev->intf, cmd_convert, NULL, 0);
+    MS5611_CmdWrite(dev, dev->intf, cmd_convert);
 }
 
 int8_t MS5611_AdcRead(MS5611_Device_t* dev, uint32_t* buffer){
 	int8_t rslt;
     uint8_t temp [3];
 
-    rslt = dev->read(dev->intf, MS5611_CMD_ADC_READ, temp, 3);
+    rslt = MS5611_CmdRead(dev, dev->intf, MS5611_CMD_ADC_READ, temp, 3);
     *buffer = ((uint32_t)temp[0] << 16) | ((uint32_t)temp[1] << 8) | temp[2];
     return rslt;
 }
 
-MS5611_Data_t MS5611_RawDataProcess(MS5611_Device_t* dev, uint32_t D1 , uint32_t D2, int8_t compensation){
-	MS5611_Data_t data;
+int8_t MS5611_Submit(MS5611_Device_t* dev, MS5611_Xfer_t* pXfer, uint8_t count){
+    int8_t rslt = MS5611_OK;
 
-	float dT = D2 - dev->config.C[5];
-	data.temperature = (int32_t)(2000 + (dT * dev->config.C[6]));
+    for (uint8_t i = 0; i < count; i++)
+    {
+        if (pXfer[i].intf == NULL) pXfer[i].intf = dev->intf;
+    }
+    if (MS5611_IO_HAS_SUBMIT(dev)) return MS5611_IO_SUBMIT(dev, pXfer, count);
 
-	float offset =  dev->config.C[2] + (dT * dev->config.C[4]);
-	float sens = dev->config.C[1] + (dT * dev->config.C[3]);
+    for (uint8_t i = 0; i < count; i++)
+    {
+        if (pXfer[i].len == 0) rslt |= MS5611_CmdWrite(dev, pXfer[i].intf, pXfer[i].cmd);
+        else rslt |= MS5611_CmdRead(dev, pXfer[i].intf, pXfer[i].cmd, pXfer[i].pRxData, pXfer[i].len);
+    }
+    return rslt;
+}
+
+uint32_t MS5611_Timestamp(MS5611_Device_t* dev){
+    if (MS5611_IO_HAS_TIMESTAMP(dev)) return MS5611_IO_TIMESTAMP(dev);
+    return 0;
+}
+
+void MS5611_Delay(MS5611_Device_t* dev, uint32_t ms){
+#ifdef MS5611_STATIC_INTF
+    (void)dev;
+#endif
+    MS5611_IO_DELAY(dev, ms);
+}
+
+MS5611_Data_t MS5611_RawDataProcessInt(const MS5611_Device_t* dev, uint32_t D1, uint32_t D2, int8_t compensation){
+    MS5611_Data_t data;
+    const uint16_t* C = dev->config.prom;
+
+    int32_t dT = (int32_t)D2 - ((int32_t)C[5 - MS5611_PROM_FIRST] << 8);
+    int32_t temp = 2000 + (int32_t)(((int64_t)dT * C[6 - MS5611_PROM_FIRST]) >> 23);
+    int64_t off = ((int64_t)C[2 - MS5611_PROM_FIRST] << V_OFF_SH) + (((int64_t)C[4 - MS5611_PROM_FIRST] * dT) >> V_TCO_SH);
+    int64_t sens = ((int64_t)C[1 - MS5611_PROM_FIRST] << V_SENS_SH) + (((int64_t)C[3 - MS5611_PROM_FIRST] * dT) >> V_TCS_SH);
+
+    /* All ones when the term applies, arithmetic right shift of the sign */
+    int32_t comp = -(int32_t)(compensation != 0);
+    int32_t low = ((temp - 2000) >> 31) & comp;
+    int32_t vlow = ((temp + 1500) >> 31) & low;
+    int32_t hot = ~((temp - V_HOT) >> 31) & comp;
+
+    int64_t dT2 = (int64_t)dT * dT;
+    int64_t t = (int64_t)(temp - 2000) * (temp - 2000);
+    int64_t tv = (int64_t)(temp + 1500) * (temp + 1500);
+    int64_t th = (int64_t)(temp - V_HOT) * (temp - V_HOT);
+
+    int32_t t2 = ((int32_t)((V_T2L * dT2) >> V_T2L_SH) & low) | ((int32_t)((V_T2H * dT2) >> V_T2H_SH) & hot);
+    int64_t off2 = (((V_OFF2L * t) >> V_OFF2L_SH) + ((V_OFF2V * tv) & vlow)) & low;
+    int64_t sens2 = ((((V_SENS2L * t) >> V_SENS2L_SH) + (((V_SENS2V * tv) >> V_SENS2V_SH) & vlow)) & low)
+                  | (((V_SENS2H * th) >> V_SENS2H_SH) & hot);
+
+    data.temperature = temp - t2;
+    off -= off2;
+    sens -= sens2;
+
+    data.pressure = (int32_t)(((((int64_t)D1 * sens) >> 21) - off) >> 15);
+    return data;
+}
+
+#ifdef MS5611_FLOAT_KERNEL
+/* Float kernel : pressure (Pa) unrounded, temperature as the integer and float result */
+static float MS5611_ProcessFloat(const MS5611_Device_t* dev, uint32_t D1, uint32_t D2, int8_t compensation, int32_t* pTemp, float* pTempF){
+	float dT = (float)D2 - dev->config.C[5];
+	float tempF = 2000.0f + (dT * dev->config.C[6]);
+	int32_t temp = (int32_t)tempF;
+
+	/* Fused : pressure = D1 * (SENS / 2^36) - (OFF / 2^15) */
+	float sens = dev->config.F[0] + (dT * dev->config.F[1]);
+	float offset = dev->config.F[2] + (dT * dev->config.F[3]);
 
 	if (compensation)
 	{
-		if (data.temperature < 2000)
+		if (temp < 2000)
 		{
-			float T2 = dT * dT * 4.6566128731E-10;
-			float t = (data.temperature - 2000) * (data.temperature - 2000);
-			float offset2 = 2.5 * t;
-			float sens2 = 1.25 * t;
-			if (data.temperature < -1500)
+			float T2 = dT * dT * 4.6566128731E-10f;
+			float t = (float)((temp - 2000) * (temp - 2000));
+			float offset2 = 2.5f * t;
+			float sens2 = 1.25f * t;
+			if (temp < -1500)
 			{
-				t = (float)((data.temperature + 1500) * (data.temperature + 1500));
-				offset2 += 7 * t;
-				sens2 += 5.5 * t;
+				t = (float)((temp + 1500) * (temp + 1500));
+				offset2 += 7.0f * t;
+				sens2 += 5.5f * t;
 			}
-			data.temperature -= T2;
-			offset -= offset2;
-			sens -= sens2;
+			temp = (int32_t)((float)temp - T2);
+			tempF -= T2;
+			offset -= offset2 * 3.0517578125E-5f;   /* 2^-15 */
+			sens -= sens2 * 1.4551915228E-11f;      /* 2^-36 */
 		}
 	}
 
-	data.pressure = (D1 * sens * 4.76837158205E-7 - offset) * 3.051757813E-5;
+	*pTemp = temp;
+	*pTempF = tempF;
+	return (float)D1 * sens - offset;
+}
+#endif
+
+MS5611_Data_t MS5611_RawDataProcess(MS5611_Device_t* dev, uint32_t D1 , uint32_t D2, int8_t compensation){
+#ifndef MS5611_FLOAT_KERNEL
+    return MS5611_RawDataProcessInt(dev, D1, D2, compensation);
+#else
+	MS5611_Data_t data;
+	float tempF;
+	float press = MS5611_ProcessFloat(dev, D1, D2, compensation, &data.temperature, &tempF);
+	data.pressure = (int32_t)press;
 	return data;
+#endif
+}
+
+int8_t MS5611_RawDataProcessAs(MS5611_Device_t* dev, uint32_t D1, uint32_t D2, int8_t compensation, MS5611_Format_t fmt, MS5611_Output_t* pOut){
+#ifdef MS5611_FLOAT_KERNEL
+    if (fmt == MS5611_FMT_FLOAT)
+    {
+        int32_t temp;
+        pOut->pressure.f = MS5611_ProcessFloat(dev, D1, D2, compensation, &temp, &pOut->temperature.f) * 0.01f;
+        pOut->temperature.f *= 0.01f;
+        return MS5611_OK;
+    }
+#endif
+    MS5611_Data_t data = MS5611_RawDataProcess(dev, D1, D2, compensation);
+    return MS5611_Format(&data, fmt, pOut);
+}
+
+int8_t MS5611_Format(const MS5611_Data_t* pData, MS5611_Format_t fmt, MS5611_Output_t* pOut){
+    if (MS5611_FormatCheck(fmt) != MS5611_OK) return MS5611_ERROR;
+
+    switch (fmt)
+    {
+    case MS5611_FMT_Q16:
+        /* x / 100 * 2^16 = (x * 655.36 * 2^16) >> 16, rounded */
+        pOut->temperature.i = (int32_t)(((int64_t)pData->temperature * 42949673 + 32768) >> 16);
+        pOut->pressure.i = (int32_t)(((int64_t)pData->pressure * 42949673 + 32768) >> 16);
+        break;
+#ifndef MS5611_MINIMAL
+    case MS5611_FMT_FLOAT:
+        pOut->temperature.f = (float)pData->temperature * 0.01f;
+        pOut->pressure.f = (float)pData->pressure * 0.01f;
+        break;
+#endif
+    default:
+        pOut->temperature.i = pData->temperature;
+        pOut->pressure.i = pData->pressure;
+        break;
+    }
+    return MS5611_OK;
 }
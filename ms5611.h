@@ -29,13 +29,87 @@
 
 #define MS5611_OK             0
 #define MS5611_ERROR          1
+#define MS5611_BUSY           2     /* Conversion in progress (MS5611_Poll) */
+
+#ifndef MS5611_BUS_MS
+#define MS5611_BUS_MS         1     /* Bus allowance per conversion : command + ADC read (~0.7 ms at 100 kHz I2C) */
+#endif
+#ifndef MS5611_D2_MAX_AGE
+#define MS5611_D2_MAX_AGE     1000  /* Oldest cached raw temperature MS5611_GetDataBy reuses (ms) */
+#endif
+#define MS5611_RESET_MS       20    /* PROM reload after the reset command (MS5611_Init) */
+
+#define MS5611_PROM_CRC       0x01  /* MS5611_PromCheck : CRC-4 mismatch */
+#define MS5611_PROM_RANGE     0x02  /* MS5611_PromCheck : coefficient out of its plausible range */
 
 #define MS5611_I2C_ADDRESS    0x77
+#define MS5611_SPI_FRAME_MAX  4     /* Command + 24 bit ADC result */
+
+/*
+ * Part variant, selected at build time (-DMS5611_VARIANT=MS5611_VARIANT_MS5607).
+ * The siblings share the command set, only the compensation shifts and the
+ * second order terms differ. Each variant compiles its own integer kernel,
+ * there is no runtime branch on the part type. The float path implements the
+ * MS5611 second order only, other variants use the integer kernel.
+ */
+#define MS5611_VARIANT_MS5611       0
+#define MS5611_VARIANT_MS5607       1
+#define MS5611_VARIANT_MS5637       2
+#define MS5611_VARIANT_MS5803_01BA  3
+
+#ifndef MS5611_VARIANT
+#define MS5611_VARIANT        MS5611_VARIANT_MS5611
+#endif
+
+/*
+ * MS5611_MINIMAL : footprint profile for small RAM, FPU-less targets.
+ * Only the six calibration words are stored (12 bytes instead of 42),
+ * compensation is integer only and no float is left in the call graph :
+ * MS5611_InitConstants and MS5611_GetData are not available, use
+ * MS5611_GetDataAs, MS5611_GetDataBy or MS5611_RawDataProcess.
+ * MS5611_Poll and the raw temperature cache are left out unless
+ * MS5611_WITH_POLL / MS5611_WITH_D2_CACHE are defined.
+ */
+#ifdef MS5611_MINIMAL
+#define MS5611_PROM_FIRST     1
+#else
+#define MS5611_PROM_FIRST     0
+#endif
+
+/*
+ * MS5611_NO_POLL : leaves MS5611_Poll and its per-device cycle state out.
+ * Default in MS5611_MINIMAL.
+ */
+#if defined(MS5611_MINIMAL) && !defined(MS5611_WITH_POLL) && !defined(MS5611_NO_POLL)
+#define MS5611_NO_POLL
+#endif
+
+/*
+ * MS5611_NO_D2_CACHE : the device keeps no raw temperature, MS5611_GetDataBy
+ * then always converts D2. Default in MS5611_MINIMAL.
+ */
+#if defined(MS5611_MINIMAL) && !defined(MS5611_WITH_D2_CACHE) && !defined(MS5611_NO_D2_CACHE)
+#define MS5611_NO_D2_CACHE
+#endif
+
+/*
+ * MS5611_HEAT : self heating compensation in the sample paths. The device
+ * carries a model pointer (MS5611_HeatAttach, ms5611_heat.h) and every
+ * sample of MS5611_GetData(As/By), MS5611_Poll, the array, continuous and
+ * RTOS engines is corrected by it. Link ms5611_heat.c. Float based, not
+ * available in MS5611_MINIMAL.
+ */
+#if defined(MS5611_HEAT) && defined(MS5611_MINIMAL)
+#error "MS5611_HEAT is not available in MS5611_MINIMAL"
+#endif
 
-typedef enum{
-    MS5611_INTF_SPI,
-    MS5611_INTF_I2C
-}MS5611_Intf_e;
+/* MS5611 Has only 5 basic commands: */
+
+#define MS5611_CMD_RESET          	0x1E    /* Reset */
+#define MS5611_CMD_READ_PROM       	0xA0    /* PROM (128 bit of calibration words) */
+#define MS5611_CMD_CONV_D1         	0x40    /* D1 Conversion */
+#define MS5611_CMD_CONV_D2        	0x50    /* D2 Conversion */
+#define MS5611_CMD_ADC_READ      	0x00    /* Read ADC Result of the conversion (24 bit pressure / temperature) */
 
 typedef enum
 {
@@ -51,39 +125,122 @@ typedef struct MS5611_Data_s{
     int32_t pressure;     /* mbar * 10^2 */
 }MS5611_Data_t;
 
-typedef int8_t (*MS5611_Read_t)(void* intf, uint8_t reg, uint8_t *pRxData, uint8_t len);
-typedef int8_t (*MS5611_Write_t)(void* intf, uint8_t reg, const uint8_t *pTxData, uint8_t len);
-typedef void   (*MS5611_Delay_t)(uint32_t ms); /* Delay Microseconds function pointer */
+typedef enum
+{
+    MS5611_FMT_INT = 0,                 /* int32 centi-degC, Pa (native, no conversion) */
+    MS5611_FMT_Q16,                     /* Q16.16 degC, mbar */
+    MS5611_FMT_FLOAT,                   /* float degC, mbar (not in MS5611_MINIMAL) */
+} MS5611_Format_t;                      /* Output representation */
+
+typedef union MS5611_Value_u{
+    int32_t i;            /* MS5611_FMT_INT, MS5611_FMT_Q16 */
+    float f;              /* MS5611_FMT_FLOAT */
+}MS5611_Value_t;
+
+typedef struct MS5611_Output_s{
+    MS5611_Value_t temperature;
+    MS5611_Value_t pressure;
+}MS5611_Output_t;
+
+typedef struct MS5611_Sample_s{
+    uint32_t timestamp;   /* Transport timestamp (us) */
+    uint32_t D1;          /* Raw pressure */
+    uint32_t D2;          /* Raw temperature */
+    MS5611_Data_t data;
+}MS5611_Sample_t;
+
+typedef struct MS5611_PromRecord_s{
+    uint16_t word[8];     /* 0 : factory data, 1..6 : C1..C6, 7 : serial code / CRC */
+}MS5611_PromRecord_t;
+
+typedef struct MS5611_Xfer_s{
+    void* intf;         /* Target interface instance */
+    uint8_t cmd;        /* Command byte */
+    uint8_t* pRxData;   /* Response buffer, NULL for command only transfers */
+    uint8_t len;        /* Response length */
+}MS5611_Xfer_t;
+
+typedef int8_t   (*MS5611_Read_t)(void* intf, uint8_t reg, uint8_t *pRxData, uint8_t len);
+typedef int8_t   (*MS5611_Write_t)(void* intf, uint8_t reg, const uint8_t *pTxData, uint8_t len);
+typedef int8_t   (*MS5611_WriteRead_t)(void* intf, const uint8_t *pTxData, uint8_t txLen, uint8_t *pRxData, uint8_t rxLen);
+typedef int8_t   (*MS5611_Transfer_t)(void* intf, const uint8_t *pTxData, uint8_t *pRxData, uint8_t len); /* Full-duplex, one CS frame */
+typedef int8_t   (*MS5611_Submit_t)(void* intf, const MS5611_Xfer_t *pXfer, uint8_t count);
+typedef uint32_t (*MS5611_Timestamp_t)(void* intf); /* Microseconds timestamp function pointer */
+typedef void     (*MS5611_Delay_t)(uint32_t ms);    /* Delay Milliseconds function pointer */
+
+/*
+ * Transport operations table. One table is shared by every device on the
+ * same platform, the per device state is the intf handle.
+ * read, write and delay are mandatory. The optional entries may be NULL,
+ * the driver falls back to read/write sequences.
+ * SPI transports should provide transfer : every command and its response
+ * are then framed into a single chip select cycle (cmd + up to 3 bytes).
+ */
+typedef struct MS5611_Ops_s
+{
+    MS5611_Read_t read;             /* Command + read response */
+    MS5611_Write_t write;           /* Command (+ payload) */
+    MS5611_WriteRead_t writeRead;   /* Combined write then read transaction (optional) */
+    MS5611_Transfer_t transfer;     /* SPI full-duplex frame (optional) */
+    MS5611_Submit_t submit;         /* Batch transfer list (optional) */
+    MS5611_Timestamp_t timestamp;   /* Microseconds clock (optional) */
+    MS5611_Delay_t delay;           /* Blocking delay */
+}MS5611_Ops_t;
+
+/*
+ * Compile-time transport binding.
+ * Build the whole project with MS5611_STATIC_INTF defined to a header name
+ * (e.g. -DMS5611_STATIC_INTF='"board_ms5611.h"'). That header must define
+ * MS5611_STATIC_READ, MS5611_STATIC_WRITE and MS5611_STATIC_DELAY as the
+ * names of functions with the signatures above, and may define
+ * MS5611_STATIC_WRITEREAD, MS5611_STATIC_TRANSFER, MS5611_STATIC_SUBMIT and
+ * MS5611_STATIC_TIMESTAMP.
+ * Calls are then direct (inlinable when the functions are static inline)
+ * and the device carries no ops pointer.
+ */
 
 typedef struct MS5611_Config_s
 {
     MS5611_OSRate_t osRate; /* Output Sampling Rate */
     uint8_t ct;             /* Conversion Time */
+#ifndef MS5611_MINIMAL
     float C[7];             /* Coefficients */
+    float F[4];             /* Fused pressure coefficients (MS5611_Precompute) */
+#endif
+    uint16_t prom[7 - MS5611_PROM_FIRST]; /* Raw PROM words C[MS5611_PROM_FIRST..6] (integer path) */
 }MS5611_Config_t;
 
 typedef struct MS5611_Device_s
 {
     void* intf;
-    MS5611_Intf_e intf_type;
-    MS5611_Read_t read;
-    MS5611_Write_t write;
-    MS5611_Delay_t delay;
+#ifndef MS5611_STATIC_INTF
+    const MS5611_Ops_t* ops;
+#endif
     MS5611_Config_t config;
+#ifndef MS5611_NO_D2_CACHE
+    uint32_t D2;            /* Last raw temperature, 0 until the first read */
+    uint32_t D2Stamp;       /* Transport timestamp of D2 (us) */
+#endif
+#ifndef MS5611_NO_POLL
+    uint8_t state;          /* MS5611_Poll step */
+    uint32_t due;           /* MS5611_Poll conversion end (ms) */
+    uint32_t D1;            /* MS5611_Poll raw pressure */
+    MS5611_Data_t data;     /* MS5611_Poll latest sample */
+#endif
+#ifdef MS5611_HEAT
+    struct MS5611_Heat_s* heat; /* Self heating model, NULL when off (MS5611_HeatAttach) */
+#endif
 }MS5611_Device_t;
 
 /*
  * @brief Creates and initializes a new MS5611 device instance.
  *
- * @param[in] intf       : Interface instance (SPI/I2C).
- * @param[in] intf_type  : Interface type (SPI or I2C).
- * @param[in] readf      : Pointer to the read function.
- * @param[in] writef     : Pointer to the write function.
- * @param[in] delayf     : Pointer to the delay function.
+ * @param[in] intf  : Interface instance (SPI/I2C).
+ * @param[in] ops   : Transport operations table (ignored with MS5611_STATIC_INTF).
  *
  * @return MS5611_Device_t  : Initialized MS5611 device structure.
  */
-MS5611_Device_t MS5611_NewDevice(void* intf, MS5611_Intf_e intf_type, MS5611_Read_t readf, MS5611_Write_t writef, MS5611_Delay_t delayf);
+MS5611_Device_t MS5611_NewDevice(void* intf, const MS5611_Ops_t* ops);
 
 /*
  * @brief Initializes the MS5611 device by resetting it and loading the PROM.
@@ -114,6 +271,7 @@ int8_t MS5611_Test(MS5611_Device_t* dev);
  */
 void MS5611_Reset(MS5611_Device_t* dev);
 
+#ifndef MS5611_MINIMAL
 /*
  * @brief Initializes calibration constants for the MS5611 device.
  *
@@ -123,9 +281,13 @@ void MS5611_Reset(MS5611_Device_t* dev);
  * @return void
  */
 void MS5611_InitConstants(MS5611_Device_t* dev, int8_t mathMode);
+#endif
 
 /*
  * @brief Reads and stores PROM calibration data for the MS5611 device.
+ *        The record is validated with MS5611_PromCheck, a suspicious record
+ *        is read again (up to MS5611_PROM_RETRY) until it passes or two
+ *        consecutive reads agree.
  *
  * @param[in] dev  : Pointer to the MS5611 device structure.
  *
@@ -134,6 +296,49 @@ void MS5611_InitConstants(MS5611_Device_t* dev, int8_t mathMode);
  */
 int8_t MS5611_PROM(MS5611_Device_t* dev);
 
+#ifndef MS5611_MINIMAL
+/*
+ * @brief Folds the output scale factors into per device pressure coefficients,
+ *        so the float path needs one multiply-add for temperature and three
+ *        for pressure. Called by MS5611_PROM, call it again after editing C[].
+ *
+ * @param[in] dev  : Pointer to the MS5611 device structure.
+ *
+ * @return void
+ */
+void MS5611_Precompute(MS5611_Device_t* dev);
+#endif
+
+/*
+ * @brief Computes the CRC-4 of a PROM record (AN520), CRC bits excluded.
+ *
+ * @param[in] pRec : PROM record.
+ *
+ * @return uint8_t  : 4 bit CRC.
+ */
+uint8_t MS5611_PromCrc(const MS5611_PromRecord_t* pRec);
+
+/*
+ * @brief Validates a PROM record : stored CRC-4 and C1..C6 plausible ranges.
+ *
+ * @param[in] pRec : PROM record.
+ *
+ * @return uint8_t  : 0 when valid, else MS5611_PROM_CRC | MS5611_PROM_RANGE.
+ */
+uint8_t MS5611_PromCheck(const MS5611_PromRecord_t* pRec);
+
+/*
+ * @brief Reads all 8 PROM words in one transfer list, including the factory
+ *        and serial / CRC words MS5611_PROM skips. The device is not modified.
+ *
+ * @param[in]  dev  : Pointer to the MS5611 device structure.
+ * @param[out] pRec : PROM record.
+ *
+ * @retval 0 -> Success
+ * @retval > 0 -> Failure
+ */
+int8_t MS5611_PromDump(MS5611_Device_t* dev, MS5611_PromRecord_t* pRec);
+
 /*
  * @brief Reads calibration data from the MS5611 PROM for a given register.
  *
@@ -163,8 +368,10 @@ void MS5611_SetOSRate(MS5611_Device_t* dev, MS5611_OSRate_t osr);
  */
 MS5611_OSRate_t MS5611_GetOSRate(MS5611_Device_t* dev);
 
+#ifndef MS5611_MINIMAL
 /*
  * @brief Retrieves the processed temperature and pressure data from the MS5611 device.
+ *        Same values as MS5611_GetDataAs(MS5611_FMT_FLOAT).
  *
  * @param[in] dev     : Pointer to the MS5611 device structure.
  * @param[out] pTemp  : Pointer to store the temperature value (in °C).
@@ -174,6 +381,62 @@ MS5611_OSRate_t MS5611_GetOSRate(MS5611_Device_t* dev);
  * @retval > 0 -> Failure
  */
 int8_t MS5611_GetData(MS5611_Device_t* dev, float* pTemp, float* pPress);
+#endif
+
+/*
+ * @brief Retrieves temperature and pressure in the requested representation.
+ *        The compensation kernel output is scaled by constant multiplies only,
+ *        MS5611_FMT_FLOAT keeps the fractional Pa of the float kernel.
+ *
+ * @param[in]  dev   : Pointer to the MS5611 device structure.
+ * @param[in]  fmt   : Output representation.
+ * @param[out] pOut  : Temperature and pressure in fmt.
+ *
+ * @retval 0 -> Success
+ * @retval > 0 -> Failure, or fmt not available in this build (no bus access)
+ */
+int8_t MS5611_GetDataAs(MS5611_Device_t* dev, MS5611_Format_t fmt, MS5611_Output_t* pOut);
+
+/*
+ * @brief Retrieves a sample within a latency budget.
+ *        Picks the highest OSR whose conversions, plus MS5611_BUS_MS of bus
+ *        time each, fit the deadline. When a full temperature + pressure
+ *        cycle does not fit, a fresh pressure is combined with the cached raw
+ *        temperature of the previous cycle, if it is at most
+ *        MS5611_D2_MAX_AGE old. The age needs the transport timestamp,
+ *        without it (or with MS5611_NO_D2_CACHE) the cache is never reused.
+ *        The configured OSR is left unchanged.
+ *
+ * @param[in]  dev      : Pointer to the MS5611 device structure.
+ * @param[in]  deadline : Time budget from the call (ms).
+ * @param[in]  minOsr   : Lowest acceptable resolution.
+ * @param[out] pData    : Processed temperature and pressure data.
+ * @param[out] pOsr     : Achieved OSR (may be NULL).
+ *
+ * @retval 0 -> Success
+ * @retval > 0 -> Failure, or no OSR >= minOsr fits the deadline
+ */
+int8_t MS5611_GetDataBy(MS5611_Device_t* dev, uint32_t deadline, MS5611_OSRate_t minOsr, MS5611_Data_t* pData, MS5611_OSRate_t* pOsr);
+
+/*
+ * @brief Non-blocking acquisition step for superloops.
+ *        Moves the D1 / D2 conversion cycle one step forward and returns
+ *        immediately, never calls the delay function. State lives in the
+ *        device, so any number of sensors can share one loop.
+ *        The ADC is read ct + 1 ms ticks after its conversion command :
+ *        'now' only has tick resolution, a command issued late in a tick
+ *        would otherwise be read up to 1 ms early.
+ *
+ * @param[in] dev  : Pointer to the MS5611 device structure.
+ * @param[in] now  : Current time (ms), free running, wrap around safe.
+ *
+ * @retval 0 -> New sample in dev->data
+ * @retval 1 -> Failure (bus error, cycle restarts)
+ * @retval 2 -> Busy, call again later
+ */
+#ifndef MS5611_NO_POLL
+int8_t MS5611_Poll(MS5611_Device_t* dev, uint32_t now);
+#endif
 
 /*
  * @brief Initiates a conversion process on the MS5611 device.
@@ -196,6 +459,86 @@ void MS5611_Convert(MS5611_Device_t* dev, const uint8_t addr);
  */
 int8_t MS5611_AdcRead(MS5611_Device_t* dev, uint32_t* buffer);
 
+/*
+ * @brief Submits a transfer list to the device transport.
+ *        Entries with a NULL intf are directed to the device interface.
+ *        Without a submit operation the list is executed one by one.
+ *
+ * @param[in] dev    : Pointer to the MS5611 device structure.
+ * @param[in] pXfer  : Transfer list.
+ * @param[in] count  : Number of transfers.
+ *
+ * @retval 0 -> Success
+ * @retval > 0 -> Failure
+ */
+int8_t MS5611_Submit(MS5611_Device_t* dev, MS5611_Xfer_t* pXfer, uint8_t count);
+
+/*
+ * @brief Reads the transport timestamp.
+ *
+ * @param[in] dev  : Pointer to the MS5611 device structure.
+ *
+ * @return uint32_t  : Microseconds, 0 when the transport has no clock.
+ */
+uint32_t MS5611_Timestamp(MS5611_Device_t* dev);
+
+/*
+ * @brief Blocks for the given time through the transport delay.
+ *
+ * @param[in] dev  : Pointer to the MS5611 device structure.
+ * @param[in] ms   : Milliseconds.
+ *
+ * @return void
+ */
+void MS5611_Delay(MS5611_Device_t* dev, uint32_t ms);
+
+/*
+ * WCET budget per call (MS5611_WCET build, MS5611 variant). Conversion
+ * delays are excluded, they are the configured ct, twice per sample.
+ *
+ *   call                      bus xfers  kernels  callbacks
+ *   MS5611_RawDataProcess         0         1     -
+ *   MS5611_GetData                4         1     2 delay, 1 timestamp
+ *   MS5611_Poll (one step)      <= 2      <= 1    <= 1 timestamp
+ *
+ * Kernel : no branch, no division, no float. 7 data dependent 64 bit
+ * multiplies (8 on MS5803-01BA), constant multiplies and shifts only
+ * otherwise; 71 instructions on x86-64 at -O2 (78 on MS5803-01BA).
+ * MS5611_GetData adds 2 float multiplies for its output scaling.
+ * Host reference (x86-64, -O2, zero latency transport, median / p99 of
+ * 100k calls) : RawDataProcess ~15 / 20 ns, GetData ~30 / 40 ns, Poll
+ * step ~35 / 80 ns. The host max is preemption, not code path : the tick
+ * budget is meant for the target with interrupts masked and
+ * MS5611_BENCH_CYCLES on the cycle counter. Bus time is 4 x (~0.25 ..
+ * 0.5 ms) on 100 kHz I2C.
+ *
+ * Check : MS5611_BenchWcet (ms5611_bench.h) counts the transfers of each
+ * call against MS5611_WCET_XFER_* and times the calls with
+ * MS5611_BENCH_CYCLES, which can be bound to the cycle counter of the
+ * target to measure its cycle budget.
+ */
+#define MS5611_WCET_XFER_PROCESS  0
+#define MS5611_WCET_XFER_GETDATA  4
+#define MS5611_WCET_XFER_POLL     2
+
+/*
+ * @brief Integer, branch-free version of MS5611_RawDataProcess.
+ *        Datasheet first and second order compensation of the MS5611_VARIANT
+ *        part in 32/64 bit integer math. The low / high temperature terms are
+ *        selected with masks so every call executes the same instruction
+ *        sequence : fixed multiplies and shifts, no division and no data
+ *        dependent branch.
+ *        Building with MS5611_WCET routes MS5611_RawDataProcess to this kernel.
+ *
+ * @param[in] dev          : Pointer to the MS5611 device structure.
+ * @param[in] D1           : Raw pressure data.
+ * @param[in] D2           : Raw temperature data.
+ * @param[in] compensation : Flag to apply temperature compensation.
+ *
+ * @return MS5611_Data_t  : Processed temperature and pressure data.
+ */
+MS5611_Data_t MS5611_RawDataProcessInt(const MS5611_Device_t* dev, uint32_t D1, uint32_t D2, int8_t compensation);
+
 /*
  * @brief Processes raw ADC data to calculate temperature and pressure values.
  *
@@ -208,4 +551,31 @@ int8_t MS5611_AdcRead(MS5611_Device_t* dev, uint32_t* buffer);
  */
 MS5611_Data_t MS5611_RawDataProcess(MS5611_Device_t* dev, uint32_t D1, uint32_t D2, int8_t compensation);
 
+/*
+ * @brief Processes raw ADC data straight into the requested representation.
+ *
+ * @param[in] dev          : Pointer to the MS5611 device structure.
+ * @param[in] D1           : Raw pressure data.
+ * @param[in] D2           : Raw temperature data.
+ * @param[in] compensation : Flag to apply temperature compensation.
+ * @param[in] fmt          : Output representation.
+ * @param[out] pOut        : Temperature and pressure in fmt.
+ *
+ * @retval 0 -> Success
+ * @retval > 0 -> Failure, fmt not available in this build
+ */
+int8_t MS5611_RawDataProcessAs(MS5611_Device_t* dev, uint32_t D1, uint32_t D2, int8_t compensation, MS5611_Format_t fmt, MS5611_Output_t* pOut);
+
+/*
+ * @brief Converts processed data to the requested representation.
+ *
+ * @param[in]  pData : Processed temperature (centi-degC) and pressure (Pa).
+ * @param[in]  fmt   : Output representation.
+ * @param[out] pOut  : Temperature and pressure in fmt.
+ *
+ * @retval 0 -> Success
+ * @retval > 0 -> Failure, fmt not available in this build (MS5611_FMT_FLOAT in MS5611_MINIMAL)
+ */
+int8_t MS5611_Format(const MS5611_Data_t* pData, MS5611_Format_t fmt, MS5611_Output_t* pOut);
+
 #endif /* MS5611_H_ */
@@ -0,0 +1,87 @@
+/*
+ *  ms5611_array.c
+ *
+ *  Created on: Oct 17, 2026
+ *  Author: agent
+ *
+ *  MS5611 multi-sensor engine for a shared SPI bus.
+ *
+ *  Updates and bug reports :  @ https://github.com/Berkin99/MS5611
+ *
+ */
+
+#include <stddef.h>
+#include "ms5611_array.h"
+#include "ms5611_heat.h"
+
+static void MS5611_ArrayQueueConvert(MS5611_Array_t* arr, uint8_t i, uint8_t* n, uint8_t conv){
+    MS5611_Xfer_t* x = &arr->xfer[(*n)++];
+    x->intf = arr->devs[i].intf;
+    x->cmd = conv + (arr->devs[i].config.osRate * 2);
+    x->pRxData = NULL;
+    x->len = 0;
+}
+
+int8_t MS5611_ArrayInit(MS5611_Array_t* arr, MS5611_Device_t* devs, uint8_t count){
+    uint8_t n = 0;
+
+    if (count == 0 || count > MS5611_ARRAY_MAX) return MS5611_ERROR;
+
+    arr->devs = devs;
+    arr->count = count;
+    arr->ready = 0;
+    arr->ct = 0;
+    arr->phase = MS5611_CMD_CONV_D2;
+
+    for (uint8_t i = 0; i < count; i++)
+    {
+        if (devs[i].config.ct > arr->ct) arr->ct = devs[i].config.ct;
+        MS5611_ArrayQueueConvert(arr, i, &n, MS5611_CMD_CONV_D2);
+    }
+    return MS5611_Submit(&devs[0], arr->xfer, n);
+}
+
+int8_t MS5611_ArrayStep(MS5611_Array_t* arr){
+    int8_t rslt;
+    uint8_t n = 0;
+    uint8_t next = (arr->phase == MS5611_CMD_CONV_D1) ? MS5611_CMD_CONV_D2 : MS5611_CMD_CONV_D1;
+
+    for (uint8_t i = 0; i < arr->count; i++)
+    {
+        MS5611_Xfer_t* x = &arr->xfer[n++];
+        x->intf = arr->devs[i].intf;
+        x->cmd = MS5611_CMD_ADC_READ;
+        x->pRxData = arr->raw[i];
+        x->len = 3;
+        MS5611_ArrayQueueConvert(arr, i, &n, next);
+    }
+    rslt = MS5611_Submit(&arr->devs[0], arr->xfer, n);
+    arr->phase = next;
+    if (rslt != MS5611_OK) return rslt;    /* rx bytes are not valid, publish nothing */
+
+    for (uint8_t i = 0; i < arr->count; i++)
+    {
+        uint32_t adc = ((uint32_t)arr->raw[i][0] << 16) | ((uint32_t)arr->raw[i][1] << 8) | arr->raw[i][2];
+
+        if (next == MS5611_CMD_CONV_D1) arr->D2[i] = adc;
+        else
+        {
+            arr->data[i] = MS5611_RawDataProcess(&arr->devs[i], adc, arr->D2[i], 1);
+            MS5611_HEAT_HOOK(&arr->devs[i], &arr->data[i], MS5611_Timestamp(&arr->devs[i]), 2);
+        }
+    }
+    if (next == MS5611_CMD_CONV_D2) arr->ready = 1;
+    return rslt;
+}
+
+int8_t MS5611_ArrayGetData(MS5611_Array_t* arr){
+    int8_t rslt = MS5611_OK;
+
+    arr->ready = 0;
+    while (!arr->ready && rslt == MS5611_OK)
+    {
+        MS5611_Delay(&arr->devs[0], arr->ct);
+        rslt = MS5611_ArrayStep(arr);
+    }
+    return rslt;
+}
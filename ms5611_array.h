@@ -0,0 +1,76 @@
+/*
+ *  ms5611_array.h
+ *
+ *  Created on: Oct 17, 2026
+ *  Author: agent
+ *
+ *  MS5611 multi-sensor engine for a shared SPI bus.
+ *  Every sensor has its own chip select (intf), the bus transport
+ *  of the first device executes the pipelined transfer list.
+ *
+ *  One step per conversion time :
+ *      ADC read sensor 0, convert sensor 0, ADC read sensor 1, convert sensor 1 ...
+ *  so all sensors convert in parallel while the bus serves the others.
+ *
+ *  Updates and bug reports :  @ https://github.com/Berkin99/MS5611
+ *
+ */
+
+#ifndef MS5611_ARRAY_H_
+#define MS5611_ARRAY_H_
+
+#include "ms5611.h"
+
+#ifndef MS5611_ARRAY_MAX
+#define MS5611_ARRAY_MAX      16
+#endif
+
+typedef struct MS5611_Array_s
+{
+    MS5611_Device_t* devs;                      /* Initialized devices, one per chip select */
+    uint8_t count;
+    uint8_t phase;                              /* Conversion in flight : MS5611_CMD_CONV_D1 / D2 */
+    uint8_t ct;                                 /* Step period, slowest conversion time */
+    uint8_t ready;                              /* Set when data[] is refreshed */
+    uint32_t D2[MS5611_ARRAY_MAX];              /* Last raw temperature */
+    uint8_t raw[MS5611_ARRAY_MAX][3];           /* ADC frames */
+    MS5611_Xfer_t xfer[2 * MS5611_ARRAY_MAX];   /* Transfer list */
+    MS5611_Data_t data[MS5611_ARRAY_MAX];       /* Latest samples */
+}MS5611_Array_t;
+
+/*
+ * @brief Binds initialized devices to the engine and starts the first
+ *        temperature conversions on all chips.
+ *
+ * @param[out] arr   : Pointer to the engine structure.
+ * @param[in]  devs  : Devices (MS5611_Init done), devs[0] transport drives the bus.
+ * @param[in]  count : Number of devices, up to MS5611_ARRAY_MAX.
+ *
+ * @retval 0 -> Success
+ * @retval > 0 -> Failure
+ */
+int8_t MS5611_ArrayInit(MS5611_Array_t* arr, MS5611_Device_t* devs, uint8_t count);
+
+/*
+ * @brief Collects the finished conversions of all chips and starts the next
+ *        ones in one transfer list. Call every arr->ct milliseconds.
+ *        arr->ready is set after each pressure pass.
+ *
+ * @param[in] arr  : Pointer to the engine structure.
+ *
+ * @retval 0 -> Success
+ * @retval > 0 -> Failure
+ */
+int8_t MS5611_ArrayStep(MS5611_Array_t* arr);
+
+/*
+ * @brief Blocking helper, runs steps until a complete sample set is ready.
+ *
+ * @param[in] arr  : Pointer to the engine structure.
+ *
+ * @retval 0 -> Success
+ * @retval > 0 -> Failure
+ */
+int8_t MS5611_ArrayGetData(MS5611_Array_t* arr);
+
+#endif /* MS5611_ARRAY_H_ */
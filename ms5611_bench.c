@@ -0,0 +1,283 @@
+/*
+ *  ms5611_bench.c
+ *
+ *  Created on: Oct 17, 2026
+ *  Author: agent
+ *
+ *  MS5611 conversion benchmark and ground-truth scoring (hosted, POSIX clock).
+ *
+ *  Updates and bug reports :  @ https://github.com/Berkin99/MS5611
+ *
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <math.h>
+#include <stdlib.h>
+#include <time.h>
+#include "ms5611_bench.h"
+#include "ms5611_variant.h"
+#include "ms5611_sim.h"
+
+#define MS5611_BENCH_CHUNK      64      /* Calls per latency measurement */
+
+static MS5611_Data_t MS5611_BenchInt(MS5611_Device_t* dev, uint32_t D1, uint32_t D2){
+    return MS5611_RawDataProcessInt(dev, D1, D2, 1);
+}
+
+#ifdef MS5611_FLOAT_KERNEL
+static MS5611_Data_t MS5611_BenchFloat(MS5611_Device_t* dev, uint32_t D1, uint32_t D2){
+    return MS5611_RawDataProcess(dev, D1, D2, 1);
+}
+#endif
+
+const MS5611_BenchPath_t MS5611_BenchPaths[] = {
+#ifdef MS5611_FLOAT_KERNEL
+    {"float", MS5611_BenchFloat},
+#endif
+    {"integer", MS5611_BenchInt},
+    {NULL, NULL}
+};
+
+uint64_t MS5611_BenchNs(void){
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static int MS5611_BenchCompare(const void* a, const void* b){
+    double x = *(const double*)a, y = *(const double*)b;
+    return (x > y) - (x < y);
+}
+
+void MS5611_BenchSynthetic(const MS5611_Device_t* dev, MS5611_BenchSet_t* set, uint32_t count){
+    const uint16_t* C = dev->config.prom;
+    uint32_t side = 1;
+
+    while (side * side < count) side++;
+    for (uint32_t i = 0; i < count; i++)
+    {
+        /* Inverse first order model on a temperature x pressure grid */
+        int64_t temp = -4000 + (int64_t)12500 * (i % side) / side;
+        int64_t press = 1000 + (int64_t)119000 * (i / side) / side;
+        int64_t dT = ((temp - 2000) << 23) / C[6 - MS5611_PROM_FIRST];
+        int64_t off = ((int64_t)C[2 - MS5611_PROM_FIRST] << V_OFF_SH) + (((int64_t)C[4 - MS5611_PROM_FIRST] * dT) >> V_TCO_SH);
+        int64_t sens = ((int64_t)C[1 - MS5611_PROM_FIRST] << V_SENS_SH) + (((int64_t)C[3 - MS5611_PROM_FIRST] * dT) >> V_TCS_SH);
+        int64_t D1 = (((press << 15) + off) << 21) / sens;
+
+        set->D2[i] = (uint32_t)(((int64_t)C[5 - MS5611_PROM_FIRST] << 8) + dT) & 0xFFFFFF;
+        set->D1[i] = (uint32_t)(D1 < 0 ? 0 : D1 > 0xFFFFFF ? 0xFFFFFF : D1);
+    }
+    set->count = count;
+}
+
+void MS5611_BenchTruth(const MS5611_Device_t* dev, uint32_t D1, uint32_t D2, double* pTemp, double* pPress){
+    const uint16_t* C = dev->config.prom;
+    double dT = (double)D2 - ldexp(C[5 - MS5611_PROM_FIRST], 8);
+    double temp = 2000.0 + ldexp(dT * C[6 - MS5611_PROM_FIRST], -23);
+    double off = ldexp(C[2 - MS5611_PROM_FIRST], V_OFF_SH) + ldexp(C[4 - MS5611_PROM_FIRST] * dT, -V_TCO_SH);
+    double sens = ldexp(C[1 - MS5611_PROM_FIRST], V_SENS_SH) + ldexp(C[3 - MS5611_PROM_FIRST] * dT, -V_TCS_SH);
+    double t2 = 0.0, off2 = 0.0, sens2 = 0.0;
+
+    /* Datasheet second order in double, no intermediate truncation */
+    if (temp < 2000.0)
+    {
+        double t = (temp - 2000.0) * (temp - 2000.0);
+        t2 = ldexp(V_T2L * dT * dT, -V_T2L_SH);
+        off2 = ldexp(V_OFF2L * t, -V_OFF2L_SH);
+        sens2 = ldexp(V_SENS2L * t, -V_SENS2L_SH);
+        if (temp < -1500.0)
+        {
+            double tv = (temp + 1500.0) * (temp + 1500.0);
+            off2 += V_OFF2V * tv;
+            sens2 += ldexp(V_SENS2V * tv, -V_SENS2V_SH);
+        }
+    }
+    else if (temp >= V_HOT)
+    {
+        t2 = ldexp(V_T2H * dT * dT, -V_T2H_SH);
+        sens2 = ldexp(V_SENS2H * (temp - V_HOT) * (temp - V_HOT), -V_SENS2H_SH);
+    }
+    *pTemp = temp - t2;
+    *pPress = ldexp(ldexp((double)D1 * (sens - sens2), -21) - (off - off2), -15);
+}
+
+uint32_t MS5611_BenchLoad(FILE* file, MS5611_BenchSet_t* set){
+    unsigned long d1, d2;
+    uint32_t n = 0;
+
+    while (n < set->count && fscanf(file, " %lu , %lu", &d1, &d2) == 2)
+    {
+        set->D1[n] = (uint32_t)d1;
+        set->D2[n] = (uint32_t)d2;
+        n++;
+    }
+    set->count = n;
+    return n;
+}
+
+int8_t MS5611_BenchRun(MS5611_Device_t* dev, const MS5611_BenchSet_t* sets, uint8_t count, const MS5611_BenchPath_t* paths, FILE* report){
+    for (uint8_t s = 0; s < count; s++)
+    {
+        const MS5611_BenchSet_t* set = &sets[s];
+        uint32_t chunks = (set->count + MS5611_BENCH_CHUNK - 1) / MS5611_BENCH_CHUNK;
+        double* lat = malloc(sizeof(double) * (chunks ? chunks : 1));
+
+        if (lat == NULL) return MS5611_ERROR;
+
+        for (const MS5611_BenchPath_t* path = paths; path->name != NULL; path++)
+        {
+            volatile int32_t sink = 0;
+            uint64_t total = 0;
+            double errT = 0, errP = 0, maxT = 0, maxP = 0;
+
+            for (uint32_t c = 0; c < chunks; c++)
+            {
+                uint32_t first = c * MS5611_BENCH_CHUNK;
+                uint32_t last = first + MS5611_BENCH_CHUNK;
+                uint64_t t0;
+
+                if (last > set->count) last = set->count;
+                t0 = MS5611_BenchNs();
+                for (uint32_t i = first; i < last; i++) sink += path->process(dev, set->D1[i], set->D2[i]).pressure;
+                t0 = MS5611_BenchNs() - t0;
+                total += t0;
+                lat[c] = (double)t0 / (last - first);
+            }
+
+            /* Error against the double precision datasheet model */
+            for (uint32_t i = 0; i < set->count; i++)
+            {
+                double refT, refP;
+                MS5611_Data_t out = path->process(dev, set->D1[i], set->D2[i]);
+                MS5611_BenchTruth(dev, set->D1[i], set->D2[i], &refT, &refP);
+                double dt = fabs(out.temperature - refT);
+                double dp = fabs(out.pressure - refP);
+                errT += dt;
+                errP += dp;
+                if (dt > maxT) maxT = dt;
+                if (dp > maxP) maxP = dp;
+            }
+
+            qsort(lat, chunks, sizeof(double), MS5611_BenchCompare);
+            fprintf(report,
+                    "{\"dataset\":\"%s\",\"path\":\"%s\",\"samples\":%lu,"
+                    "\"msamples_per_s\":%.3f,\"p50_ns\":%.2f,\"p90_ns\":%.2f,\"p99_ns\":%.2f,"
+                    "\"temp_err_mean\":%.4f,\"temp_err_max\":%.3f,\"press_err_mean\":%.4f,\"press_err_max\":%.3f}\n",
+                    set->name, path->name, (unsigned long)set->count,
+                    total ? (double)set->count * 1000.0 / (double)total : 0.0,
+                    chunks ? lat[chunks / 2] : 0.0, chunks ? lat[(chunks * 9) / 10] : 0.0, chunks ? lat[(chunks * 99) / 100] : 0.0,
+                    set->count ? errT / set->count : 0.0, maxT, set->count ? errP / set->count : 0.0, maxP);
+            (void)sink;
+        }
+        free(lat);
+    }
+    return MS5611_OK;
+}
+
+/* WCET check : zero latency simulated transport (ms5611_sim.h) counting its transfers */
+
+static int MS5611_BenchCompareU64(const void* a, const void* b){
+    uint64_t x = *(const uint64_t*)a, y = *(const uint64_t*)b;
+    return (x > y) - (x < y);
+}
+
+int8_t MS5611_BenchWcet(const MS5611_Device_t* dev, uint32_t iterations, const uint64_t* budget, FILE* report){
+    static const char* names[MS5611_WCET_COUNT] = {"RawDataProcess", "GetData", "Poll"};
+    static const uint32_t xferBudget[MS5611_WCET_COUNT] = {MS5611_WCET_XFER_PROCESS, MS5611_WCET_XFER_GETDATA, MS5611_WCET_XFER_POLL};
+    MS5611_Sim_t bus;
+    MS5611_SimPart_t part;
+    MS5611_Device_t d = *dev;
+    MS5611_BenchSet_t set;
+    uint64_t* ticks = malloc(sizeof(uint64_t) * (iterations ? iterations : 1));
+    uint64_t overhead = UINT64_MAX;
+    int8_t rslt = MS5611_OK;
+    volatile int32_t sink = 0;
+
+    set.D1 = malloc(sizeof(uint32_t) * (iterations ? iterations : 1));
+    set.D2 = malloc(sizeof(uint32_t) * (iterations ? iterations : 1));
+    if (ticks == NULL || set.D1 == NULL || set.D2 == NULL || iterations == 0)
+    {
+        free(ticks);
+        free(set.D1);
+        free(set.D2);
+        return MS5611_ERROR;
+    }
+    MS5611_BenchSynthetic(dev, &set, iterations);
+
+    MS5611_SimInit(&bus, MS5611_SIM_INSTANT, NULL, NULL);
+    MS5611_SimAttach(&bus, &part);
+    d.intf = &part;
+#ifndef MS5611_STATIC_INTF
+    d.ops = &MS5611_SimOps;
+#endif
+
+    for (uint32_t i = 0; i < 1000; i++)
+    {
+        uint64_t t0 = MS5611_BENCH_CYCLES();
+        uint64_t t1 = MS5611_BENCH_CYCLES();
+        if (t1 - t0 < overhead) overhead = t1 - t0;
+    }
+
+    for (uint8_t call = 0; call < MS5611_WCET_COUNT; call++)
+    {
+        uint32_t maxXfers = 0;
+
+#ifdef MS5611_STATIC_INTF
+        if (call != MS5611_WCET_PROCESS) continue;
+#endif
+#ifdef MS5611_MINIMAL
+        if (call == MS5611_WCET_GETDATA) continue;
+#endif
+#ifdef MS5611_NO_POLL
+        if (call == MS5611_WCET_POLL) continue;
+#endif
+        for (uint32_t i = 0; i < iterations; i++)
+        {
+            uint64_t t0;
+            uint32_t x0 = bus.xfers;
+
+            t0 = MS5611_BENCH_CYCLES();
+            switch (call)
+            {
+            case MS5611_WCET_PROCESS:
+                sink += MS5611_RawDataProcess(&d, set.D1[i], set.D2[i], 1).pressure;
+                break;
+#ifndef MS5611_STATIC_INTF
+#ifndef MS5611_MINIMAL
+            case MS5611_WCET_GETDATA:
+            {
+                float temp, press;
+                sink += MS5611_GetData(&d, &temp, &press);
+                break;
+            }
+#endif
+#ifndef MS5611_NO_POLL
+            case MS5611_WCET_POLL:
+                sink += MS5611_Poll(&d, d.due);     /* Always due : one step per call */
+                break;
+#endif
+#endif
+            default:
+                break;
+            }
+            t0 = MS5611_BENCH_CYCLES() - t0;
+            ticks[i] = (t0 > overhead) ? t0 - overhead : 0;
+            if (bus.xfers - x0 > maxXfers) maxXfers = bus.xfers - x0;
+        }
+
+        qsort(ticks, iterations, sizeof(uint64_t), MS5611_BenchCompareU64);
+        if (maxXfers > xferBudget[call]) rslt = MS5611_ERROR;
+        if (budget != NULL && ticks[iterations - 1] > budget[call]) rslt = MS5611_ERROR;
+        fprintf(report, "{\"call\":\"%s\",\"xfers\":%lu,\"xfers_budget\":%lu,\"p50\":%llu,\"p99\":%llu,\"max\":%llu,\"budget\":%llu}\n",
+                names[call], (unsigned long)maxXfers, (unsigned long)xferBudget[call],
+                (unsigned long long)ticks[iterations / 2], (unsigned long long)ticks[(uint64_t)iterations * 99 / 100],
+                (unsigned long long)ticks[iterations - 1],
+                (unsigned long long)(budget ? budget[call] : 0));
+    }
+    (void)sink;
+    free(ticks);
+    free(set.D1);
+    free(set.D2);
+    return rslt;
+}
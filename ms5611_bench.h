@@ -0,0 +1,137 @@
+/*
+ *  ms5611_bench.h
+ *
+ *  Created on: Oct 17, 2026
+ *  Author: agent
+ *
+ *  MS5611 conversion benchmark and ground-truth scoring (hosted, POSIX clock).
+ *  Runs every conversion path over D1/D2 datasets and writes one JSON line
+ *  per (dataset, path) : throughput, latency percentiles and error against
+ *  the ground truth, the datasheet model (first and second order of the
+ *  MS5611_VARIANT part) evaluated in double precision for every D1/D2 row.
+ *  Each path truncates to integer centi-degC / Pa, so a correct kernel
+ *  stays within about 1 on the max errors. The output is meant to be diffed in CI.
+ *
+ *  Datasets are either synthetic (T/P sweep through the inverse first order
+ *  model of a device PROM) or loaded from "D1,D2" text files, e.g. extracted
+ *  from a recorded transcript (ms5611_trace.h).
+ *
+ *  Updates and bug reports :  @ https://github.com/Berkin99/MS5611
+ *
+ */
+
+#ifndef MS5611_BENCH_H_
+#define MS5611_BENCH_H_
+
+#include <stdio.h>
+#include "ms5611.h"
+
+typedef struct MS5611_BenchSet_s
+{
+    const char* name;
+    uint32_t* D1;
+    uint32_t* D2;
+    uint32_t count;
+}MS5611_BenchSet_t;
+
+typedef MS5611_Data_t (*MS5611_BenchProcess_t)(MS5611_Device_t* dev, uint32_t D1, uint32_t D2);
+
+typedef struct MS5611_BenchPath_s
+{
+    const char* name;
+    MS5611_BenchProcess_t process;
+}MS5611_BenchPath_t;
+
+/* Built-in conversion paths, terminated by a NULL name. "float" is listed when MS5611_RawDataProcess runs the float kernel. */
+extern const MS5611_BenchPath_t MS5611_BenchPaths[];
+
+/*
+ * @brief Fills a synthetic dataset : -40..85 C and 10..1200 mbar sweep.
+ *
+ * @param[in]  dev   : Device with loaded PROM.
+ * @param[out] set   : Dataset, D1 / D2 buffers of count entries.
+ * @param[in]  count : Samples to generate.
+ *
+ * @return void
+ */
+void MS5611_BenchSynthetic(const MS5611_Device_t* dev, MS5611_BenchSet_t* set, uint32_t count);
+
+/*
+ * @brief Ground truth of one raw pair : datasheet model in double precision.
+ *
+ * @param[in]  dev    : Device with loaded PROM.
+ * @param[in]  D1     : Raw pressure.
+ * @param[in]  D2     : Raw temperature.
+ * @param[out] pTemp  : Temperature (centi-degC), unrounded.
+ * @param[out] pPress : Pressure (Pa), unrounded.
+ *
+ * @return void
+ */
+void MS5611_BenchTruth(const MS5611_Device_t* dev, uint32_t D1, uint32_t D2, double* pTemp, double* pPress);
+
+/*
+ * @brief Loads "D1,D2" lines (decimal) into a dataset.
+ *
+ * @param[in]  file : Opened text file.
+ * @param[out] set  : Dataset, D1 / D2 buffers of set->count entries.
+ *
+ * @return uint32_t  : Samples loaded, set->count is updated.
+ */
+uint32_t MS5611_BenchLoad(FILE* file, MS5611_BenchSet_t* set);
+
+/*
+ * @brief Runs every path over every dataset and writes the JSON lines report.
+ *
+ * @param[in] dev    : Device with loaded PROM.
+ * @param[in] sets   : Datasets.
+ * @param[in] count  : Number of datasets.
+ * @param[in] paths  : Paths (MS5611_BenchPaths), NULL name terminated.
+ * @param[in] report : Report output.
+ *
+ * @retval 0 -> Success
+ * @retval > 0 -> Failure
+ */
+int8_t MS5611_BenchRun(MS5611_Device_t* dev, const MS5611_BenchSet_t* sets, uint8_t count, const MS5611_BenchPath_t* paths, FILE* report);
+
+/* Per call counter for MS5611_BenchWcet, define to the MCU cycle counter (e.g. DWT->CYCCNT) */
+#ifndef MS5611_BENCH_CYCLES
+#define MS5611_BENCH_CYCLES()   MS5611_BenchNs()
+#endif
+
+typedef enum
+{
+    MS5611_WCET_PROCESS = 0,    /* MS5611_RawDataProcess */
+    MS5611_WCET_GETDATA,        /* MS5611_GetData, delays excluded */
+    MS5611_WCET_POLL,           /* MS5611_Poll, one step */
+    MS5611_WCET_COUNT,
+} MS5611_WcetCall_e;
+
+/*
+ * @brief Monotonic host clock (ns), default MS5611_BENCH_CYCLES.
+ *
+ * @return uint64_t  : Nanoseconds.
+ */
+uint64_t MS5611_BenchNs(void);
+
+/*
+ * @brief Checks the WCET budget table of ms5611.h. Runs each call of the
+ *        table on a zero latency counting transport (delays return at
+ *        once), counts its bus transfers against MS5611_WCET_XFER_* and
+ *        times it with MS5611_BENCH_CYCLES. Writes one JSON line per call :
+ *        transfers, median, p99 and max counter ticks (counter read
+ *        overhead removed). The max is the WCET figure on a target run
+ *        with interrupts masked; on a host it is dominated by preemption,
+ *        use the p99 there. GetData and Poll need the ops table transport
+ *        and are skipped with MS5611_STATIC_INTF.
+ *
+ * @param[in] dev        : Device with loaded PROM.
+ * @param[in] iterations : Calls per entry.
+ * @param[in] budget     : Max ticks per MS5611_WcetCall_e (NULL to report only).
+ * @param[in] report     : Report output.
+ *
+ * @retval 0 -> Success, every call within its transfer and tick budget
+ * @retval > 0 -> Failure, a budget is exceeded
+ */
+int8_t MS5611_BenchWcet(const MS5611_Device_t* dev, uint32_t iterations, const uint64_t* budget, FILE* report);
+
+#endif /* MS5611_BENCH_H_ */
@@ -0,0 +1,137 @@
+/*
+ *  ms5611_continuous.c
+ *
+ *  Created on: Oct 17, 2026
+ *  Author: agent
+ *
+ *  MS5611 continuous conversion engine.
+ *
+ *  Updates and bug reports :  @ https://github.com/Berkin99/MS5611
+ *
+ */
+
+#include <stddef.h>
+#include "ms5611_continuous.h"
+#include "ms5611_heat.h"
+
+int8_t MS5611_ContinuousStart(MS5611_Continuous_t* cont, MS5611_Device_t* dev, uint32_t rateHz, uint8_t tempEvery, MS5611_SampleCb_t callback, void* ctx){
+    MS5611_OSRate_t osr = MS5611_ULTRA_HIGH_RES;
+
+    if (rateHz == 0 || tempEvery == 0 || callback == NULL) return MS5611_ERROR;
+
+    /* Conversions per second : rate pressures + rate / tempEvery temperatures */
+    cont->periodUs = (uint32_t)(((uint64_t)1000000UL * tempEvery) / ((uint64_t)rateHz * (tempEvery + 1U)));
+    for (;;)
+    {
+        MS5611_SetOSRate(dev, osr);
+        if ((uint32_t)dev->config.ct * 1000UL <= cont->periodUs) break;
+        if (osr == MS5611_ULTRA_LOW_POWER) return MS5611_ERROR;
+        osr--;
+    }
+
+    cont->dev = dev;
+    cont->callback = callback;
+    cont->ctx = ctx;
+    cont->tempEvery = tempEvery;
+    cont->count = 0;
+    cont->write = 0;
+    cont->D2 = 0;
+    cont->errors = 0;
+    cont->queue = NULL;
+    cont->phase = MS5611_CMD_CONV_D2;
+    MS5611_Convert(dev, MS5611_CMD_CONV_D2);
+    return MS5611_OK;
+}
+
+void MS5611_ContinuousTick(MS5611_Continuous_t* cont){
+    MS5611_Device_t* dev = cont->dev;
+    MS5611_Sample_t* sample = &cont->buffer[cont->write];
+    uint8_t next = MS5611_CMD_CONV_D1;
+    uint32_t adc;
+
+    if (MS5611_AdcRead(dev, &adc) != MS5611_OK)
+    {
+        /* Restart from a temperature conversion */
+        cont->errors++;
+        cont->phase = MS5611_CMD_CONV_D2;
+        MS5611_Convert(dev, MS5611_CMD_CONV_D2);
+        return;
+    }
+
+    if (cont->phase == MS5611_CMD_CONV_D2)
+    {
+        cont->D2 = adc;
+#ifndef MS5611_NO_D2_CACHE
+        dev->D2 = adc;                              /* Shared with MS5611_GetDataBy */
+        dev->D2Stamp = MS5611_Timestamp(dev);
+#endif
+        cont->count = 0;
+    }
+    else if (++cont->count >= cont->tempEvery)
+    {
+        next = MS5611_CMD_CONV_D2;
+    }
+
+    /* Next conversion first, processing overlaps with it */
+    MS5611_Convert(dev, next);
+
+    if (cont->phase == MS5611_CMD_CONV_D1 && cont->queue != NULL)
+    {
+        MS5611_RawQueue_t* q = cont->queue;
+        uint16_t head = q->head;
+
+        if ((uint16_t)(head - q->tail) >= MS5611_RAWQ_LEN)
+        {
+            q->dropped++;
+        }
+        else
+        {
+            sample = &q->buffer[head & (MS5611_RAWQ_LEN - 1)];
+            sample->timestamp = MS5611_Timestamp(dev);
+            sample->D1 = adc;
+            sample->D2 = cont->D2;
+            MS5611_BARRIER();
+            q->head = head + 1;
+        }
+    }
+    else if (cont->phase == MS5611_CMD_CONV_D1)
+    {
+        sample->timestamp = MS5611_Timestamp(dev);
+        sample->D1 = adc;
+        sample->D2 = cont->D2;
+        sample->data = MS5611_RawDataProcess(dev, adc, cont->D2, 1);
+        MS5611_HEAT_HOOK(dev, &sample->data, sample->timestamp, (cont->count == 1) ? 2 : 1);   /* 2 right after D2 */
+        cont->write ^= 1;
+        cont->callback(sample, cont->ctx);
+    }
+    cont->phase = next;
+}
+
+void MS5611_ContinuousAttachQueue(MS5611_Continuous_t* cont, MS5611_RawQueue_t* queue){
+    queue->head = 0;
+    queue->tail = 0;
+    queue->dropped = 0;
+    MS5611_BARRIER();
+    cont->queue = queue;
+}
+
+uint16_t MS5611_ContinuousDrain(MS5611_Continuous_t* cont, uint16_t maxBatch){
+    MS5611_RawQueue_t* q = cont->queue;
+    uint16_t tail = q->tail;
+    uint16_t n = 0;
+
+    while (n < maxBatch && tail != q->head)
+    {
+        MS5611_Sample_t* sample;
+
+        MS5611_BARRIER();
+        sample = &q->buffer[tail & (MS5611_RAWQ_LEN - 1)];
+        sample->data = MS5611_RawDataProcess(cont->dev, sample->D1, sample->D2, 1);
+        MS5611_HEAT_HOOK(cont->dev, &sample->data, sample->timestamp, 1);                      /* D2 share ignored */
+        cont->callback(sample, cont->ctx);
+        MS5611_BARRIER();
+        q->tail = ++tail;
+        n++;
+    }
+    return n;
+}
@@ -0,0 +1,115 @@
+/*
+ *  ms5611_continuous.h
+ *
+ *  Created on: Oct 17, 2026
+ *  Author: agent
+ *
+ *  MS5611 continuous conversion engine.
+ *  Runs the cycle D2, D1, D1, ... D1, D2 ... (one temperature every
+ *  tempEvery pressures) from a periodic tick (timer ISR or loop) and hands
+ *  every finished sample to a callback as a const pointer into an internal
+ *  double buffer : the sample stays valid for one full tick, no copies.
+ *
+ *  ISR split : with a raw queue attached the tick only does bus work and
+ *  stores D1 / D2 / timestamp into a lock-free single producer single
+ *  consumer queue. MS5611_ContinuousDrain runs the compensation math and
+ *  the callback later, in thread context, in batches.
+ *
+ *  Updates and bug reports :  @ https://github.com/Berkin99/MS5611
+ *
+ */
+
+#ifndef MS5611_CONTINUOUS_H_
+#define MS5611_CONTINUOUS_H_
+
+#include "ms5611.h"
+
+#ifndef MS5611_RAWQ_LEN
+#define MS5611_RAWQ_LEN       16    /* Power of two */
+#endif
+
+/* Store ordering between producer (ISR) and consumer, override with e.g. __DMB() on SMP parts */
+#ifndef MS5611_BARRIER
+#if defined(__GNUC__)
+#define MS5611_BARRIER()      __asm__ volatile("" ::: "memory")
+#else
+#define MS5611_BARRIER()
+#endif
+#endif
+
+typedef struct MS5611_RawQueue_s
+{
+    MS5611_Sample_t buffer[MS5611_RAWQ_LEN];
+    volatile uint16_t head;     /* Written by the tick only */
+    volatile uint16_t tail;     /* Written by the drain only */
+    volatile uint32_t dropped;  /* Samples lost on a full queue */
+}MS5611_RawQueue_t;
+
+typedef void (*MS5611_SampleCb_t)(const MS5611_Sample_t* pSample, void* ctx);
+
+typedef struct MS5611_Continuous_s
+{
+    MS5611_Device_t* dev;
+    MS5611_SampleCb_t callback;
+    void* ctx;
+    uint32_t periodUs;          /* Tick period to program the timer with */
+    uint8_t tempEvery;          /* Pressure conversions per temperature conversion */
+    uint8_t count;              /* Pressure conversions since the last temperature */
+    uint8_t phase;              /* Conversion in flight : MS5611_CMD_CONV_D1 / D2 */
+    uint8_t write;              /* Buffer being filled */
+    uint32_t D2;                /* Last raw temperature */
+    uint32_t errors;
+    MS5611_RawQueue_t* queue;   /* ISR split, NULL to process in the tick */
+    MS5611_Sample_t buffer[2];
+}MS5611_Continuous_t;
+
+/*
+ * @brief Configures the engine for a target sample rate and starts the
+ *        first temperature conversion. Picks the highest OSR whose conversion
+ *        time fits the tick period and sets cont->periodUs.
+ *
+ * @param[out] cont      : Pointer to the engine.
+ * @param[in]  dev       : Initialized device (MS5611_Init done).
+ * @param[in]  rateHz    : Pressure samples per second.
+ * @param[in]  tempEvery : Pressure samples per temperature update (>= 1).
+ * @param[in]  callback  : Called from MS5611_ContinuousTick for each sample.
+ * @param[in]  ctx       : Callback context.
+ *
+ * @retval 0 -> Success
+ * @retval > 0 -> Failure, rate not reachable
+ */
+int8_t MS5611_ContinuousStart(MS5611_Continuous_t* cont, MS5611_Device_t* dev, uint32_t rateHz, uint8_t tempEvery, MS5611_SampleCb_t callback, void* ctx);
+
+/*
+ * @brief Collects the conversion in flight and starts the next one.
+ *        Call every cont->periodUs, e.g. from a timer interrupt.
+ *
+ * @param[in] cont : Pointer to the engine.
+ *
+ * @return void
+ */
+void MS5611_ContinuousTick(MS5611_Continuous_t* cont);
+
+/*
+ * @brief Attaches a raw queue : from now on the tick stores raw samples only
+ *        and MS5611_ContinuousDrain does the processing.
+ *
+ * @param[in] cont  : Pointer to the engine.
+ * @param[in] queue : Queue storage.
+ *
+ * @return void
+ */
+void MS5611_ContinuousAttachQueue(MS5611_Continuous_t* cont, MS5611_RawQueue_t* queue);
+
+/*
+ * @brief Processes queued raw samples and calls the callback for each.
+ *        The callback receives a pointer into the queue slot, valid until it returns.
+ *
+ * @param[in] cont     : Pointer to the engine.
+ * @param[in] maxBatch : Most samples to process in this call.
+ *
+ * @return uint16_t  : Samples processed.
+ */
+uint16_t MS5611_ContinuousDrain(MS5611_Continuous_t* cont, uint16_t maxBatch);
+
+#endif /* MS5611_CONTINUOUS_H_ */
@@ -0,0 +1,84 @@
+/*
+ *  ms5611_event.c
+ *
+ *  Created on: Oct 17, 2026
+ *  Author: agent
+ *
+ *  MS5611 pressure threshold and rate events on raw data.
+ *
+ *  Updates and bug reports :  @ https://github.com/Berkin99/MS5611
+ *
+ */
+
+#include "ms5611_event.h"
+
+#define MS5611_EVENT_SPAN     (1UL << 24)   /* Full D1 range */
+
+void MS5611_EventInit(MS5611_Event_t* ev, MS5611_Device_t* dev, int32_t above, int32_t below, int32_t rate, int32_t hyst, MS5611_EventCb_t callback, void* ctx){
+    ev->dev = dev;
+    ev->callback = callback;
+    ev->ctx = ctx;
+    ev->above = above;
+    ev->below = below;
+    ev->rate = rate;
+    ev->hyst = hyst;
+    ev->D2 = 0;
+    ev->prevD1 = 0;
+    ev->armed = MS5611_EVENT_ABOVE | MS5611_EVENT_BELOW;
+}
+
+/* Pressure is linear in D1 at fixed D2 : map through two kernel evaluations.
+   Differences in 64 bit, thresholds near the int32_t limits do not wrap */
+static uint32_t MS5611_EventRaw(int64_t pressure, int32_t p0, int64_t span){
+    int64_t raw = ((pressure - p0) * (int64_t)MS5611_EVENT_SPAN + span / 2) / span;
+    if (raw < 0) return 0;
+    if (raw >= (int64_t)MS5611_EVENT_SPAN) return MS5611_EVENT_SPAN;
+    return (uint32_t)raw;
+}
+
+void MS5611_EventMap(MS5611_Event_t* ev, uint32_t D2){
+    int32_t p0 = MS5611_RawDataProcessInt(ev->dev, 0, D2, 1).pressure;
+    int64_t span = (int64_t)MS5611_RawDataProcessInt(ev->dev, MS5611_EVENT_SPAN, D2, 1).pressure - p0;
+
+    if (span <= 0) span = 1;
+    ev->D2 = D2;
+    ev->rawAbove = MS5611_EventRaw(ev->above, p0, span);
+    ev->rawAboveArm = MS5611_EventRaw((int64_t)ev->above - ev->hyst, p0, span);
+    ev->rawBelow = MS5611_EventRaw(ev->below, p0, span);
+    ev->rawBelowArm = MS5611_EventRaw((int64_t)ev->below + ev->hyst, p0, span);
+    ev->rawRate = (ev->rate > 0) ? (uint32_t)(((int64_t)ev->rate * MS5611_EVENT_SPAN + span / 2) / span) : UINT32_MAX;
+}
+
+uint8_t MS5611_EventUpdate(MS5611_Event_t* ev, uint32_t D1, uint32_t D2){
+    uint8_t events = 0;
+
+    if (ev->D2 == 0)
+    {
+        MS5611_EventMap(ev, D2);
+        ev->prevD1 = D1;
+    }
+    else if ((D2 > ev->D2 + MS5611_EVENT_D2_TOL) || (D2 + MS5611_EVENT_D2_TOL < ev->D2))
+    {
+        MS5611_EventMap(ev, D2);
+    }
+
+    if ((ev->armed & MS5611_EVENT_ABOVE) && (D1 > ev->rawAbove))
+    {
+        events |= MS5611_EVENT_ABOVE;
+        ev->armed &= (uint8_t)~MS5611_EVENT_ABOVE;
+    }
+    else if (D1 < ev->rawAboveArm) ev->armed |= MS5611_EVENT_ABOVE;
+
+    if ((ev->armed & MS5611_EVENT_BELOW) && (D1 < ev->rawBelow))
+    {
+        events |= MS5611_EVENT_BELOW;
+        ev->armed &= (uint8_t)~MS5611_EVENT_BELOW;
+    }
+    else if (D1 > ev->rawBelowArm) ev->armed |= MS5611_EVENT_BELOW;
+
+    if (((D1 > ev->prevD1) ? (D1 - ev->prevD1) : (ev->prevD1 - D1)) > ev->rawRate) events |= MS5611_EVENT_RATE;
+    ev->prevD1 = D1;
+
+    if (events && ev->callback) ev->callback(events, D1, D2, ev->ctx);
+    return events;
+}
@@ -0,0 +1,92 @@
+/*
+ *  ms5611_event.h
+ *
+ *  Created on: Oct 17, 2026
+ *  Author: agent
+ *
+ *  MS5611 pressure threshold and rate events on raw data.
+ *  Pressure thresholds (Pa) are mapped once to raw D1 counts for the current
+ *  raw temperature, through the compensation kernel of the device. Each
+ *  sample is then checked with integer compares on D1 alone : no
+ *  compensation math until an event fires. The raw thresholds are mapped
+ *  again only when D2 has drifted by more than MS5611_EVENT_D2_TOL.
+ *
+ *  Updates and bug reports :  @ https://github.com/Berkin99/MS5611
+ *
+ */
+
+#ifndef MS5611_EVENT_H_
+#define MS5611_EVENT_H_
+
+#include "ms5611.h"
+
+#ifndef MS5611_EVENT_D2_TOL
+#define MS5611_EVENT_D2_TOL   256   /* Raw temperature drift before remapping (~1 centi-degC) */
+#endif
+
+/* Event flags */
+#define MS5611_EVENT_ABOVE    0x01  /* Pressure rose above the upper threshold */
+#define MS5611_EVENT_BELOW    0x02  /* Pressure fell below the lower threshold */
+#define MS5611_EVENT_RATE     0x04  /* Pressure step between samples beyond the rate limit */
+
+typedef void (*MS5611_EventCb_t)(uint8_t events, uint32_t D1, uint32_t D2, void* ctx);
+
+typedef struct MS5611_Event_s
+{
+    MS5611_Device_t* dev;
+    MS5611_EventCb_t callback;
+    void* ctx;
+    int32_t above;              /* Upper threshold (Pa) */
+    int32_t below;              /* Lower threshold (Pa) */
+    int32_t rate;               /* Step limit (Pa per sample), 0 disables */
+    int32_t hyst;               /* Re-arm distance (Pa) */
+    uint32_t D2;                /* Raw temperature of the mapping, 0 before the first sample */
+    uint32_t rawAbove;          /* Mapped thresholds (D1 counts) */
+    uint32_t rawAboveArm;
+    uint32_t rawBelow;
+    uint32_t rawBelowArm;
+    uint32_t rawRate;
+    uint32_t prevD1;
+    uint8_t armed;              /* MS5611_EVENT_ABOVE | MS5611_EVENT_BELOW when armed */
+}MS5611_Event_t;
+
+/*
+ * @brief Configures the detector. Both thresholds start armed.
+ *
+ * @param[out] ev       : Pointer to the detector.
+ * @param[in]  dev      : Initialized device (PROM read).
+ * @param[in]  above    : Upper threshold (Pa).
+ * @param[in]  below    : Lower threshold (Pa).
+ * @param[in]  rate     : Step limit between consecutive samples (Pa), 0 disables.
+ * @param[in]  hyst     : Distance back across a threshold to re-arm it (Pa).
+ * @param[in]  callback : Called with the fired events (may be NULL).
+ * @param[in]  ctx      : Callback context.
+ *
+ * @return void
+ */
+void MS5611_EventInit(MS5611_Event_t* ev, MS5611_Device_t* dev, int32_t above, int32_t below, int32_t rate, int32_t hyst, MS5611_EventCb_t callback, void* ctx);
+
+/*
+ * @brief Maps the thresholds to raw D1 counts for a raw temperature.
+ *        Called by MS5611_EventUpdate when needed.
+ *
+ * @param[in] ev : Pointer to the detector.
+ * @param[in] D2 : Raw temperature.
+ *
+ * @return void
+ */
+void MS5611_EventMap(MS5611_Event_t* ev, uint32_t D2);
+
+/*
+ * @brief Checks one raw sample, calls the callback when an event fires.
+ *        Usable from the MS5611_ContinuousTick context.
+ *
+ * @param[in] ev : Pointer to the detector.
+ * @param[in] D1 : Raw pressure.
+ * @param[in] D2 : Raw temperature (latest).
+ *
+ * @return uint8_t  : Fired MS5611_EVENT_* flags, 0 for none.
+ */
+uint8_t MS5611_EventUpdate(MS5611_Event_t* ev, uint32_t D1, uint32_t D2);
+
+#endif /* MS5611_EVENT_H_ */
@@ -0,0 +1,150 @@
+/*
+ *  ms5611_fleet.c
+ *
+ *  Created on: Oct 17, 2026
+ *  Author: agent
+ *
+ *  MS5611 calibration database for fleet provisioning (Linux / POSIX host).
+ *
+ *  Updates and bug reports :  @ https://github.com/Berkin99/MS5611
+ *
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <fcntl.h>
+#include <math.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "ms5611_fleet.h"
+
+uint64_t MS5611_FleetKey(const MS5611_PromRecord_t* pRec){
+    uint64_t h = 0xCBF29CE484222325ULL;
+    for (uint8_t i = 0; i < 8; i++)
+    {
+        h = (h ^ (pRec->word[i] >> 8)) * 0x100000001B3ULL;
+        h = (h ^ (pRec->word[i] & 0xFF)) * 0x100000001B3ULL;
+    }
+    return h ? h : 1;
+}
+
+int8_t MS5611_FleetOpen(MS5611_Fleet_t* fleet, const char* path, uint32_t capacity){
+    struct stat st;
+    uint32_t slots = MS5611_FLEET_SLOTS_MIN;
+
+    if (capacity > MS5611_FLEET_SLOTS_MAX) return MS5611_ERROR;
+
+    fleet->fd = open(path, O_RDWR | O_CREAT, 0644);
+    if (fleet->fd < 0) return MS5611_ERROR;
+    if (fstat(fleet->fd, &st) != 0) goto fail;
+
+    if (st.st_size == 0)
+    {
+        while (slots < capacity) slots <<= 1;
+        fleet->size = sizeof(MS5611_FleetHeader_t) + (size_t)slots * sizeof(MS5611_FleetEntry_t);
+        if (ftruncate(fleet->fd, (off_t)fleet->size) != 0) goto fail;
+    }
+    else fleet->size = (size_t)st.st_size;
+
+    fleet->header = mmap(NULL, fleet->size, PROT_READ | PROT_WRITE, MAP_SHARED, fleet->fd, 0);
+    if (fleet->header == MAP_FAILED) goto fail;
+    fleet->entry = (MS5611_FleetEntry_t*)(fleet->header + 1);
+
+    if (st.st_size == 0)
+    {
+        fleet->header->capacity = slots;    /* Zero filled by ftruncate */
+        fleet->header->magic = MS5611_FLEET_MAGIC;
+    }
+    else if (fleet->header->magic != MS5611_FLEET_MAGIC ||
+             fleet->header->capacity < MS5611_FLEET_SLOTS_MIN ||
+             (fleet->header->capacity & (fleet->header->capacity - 1)) != 0 ||
+             fleet->size != sizeof(MS5611_FleetHeader_t) + (size_t)fleet->header->capacity * sizeof(MS5611_FleetEntry_t))
+    {
+        munmap(fleet->header, fleet->size);
+        goto fail;
+    }
+    return MS5611_OK;
+
+fail:
+    fleet->header = NULL;
+    close(fleet->fd);
+    return MS5611_ERROR;
+}
+
+/* Slot holding the record, or the empty slot that ends its probe sequence. A key match is
+   confirmed on the full record, a colliding fingerprint keeps probing */
+static MS5611_FleetEntry_t* MS5611_FleetSlot(const MS5611_Fleet_t* fleet, uint64_t key, const MS5611_PromRecord_t* pRec){
+    uint32_t mask = fleet->header->capacity - 1;
+    uint32_t i = (uint32_t)(key ^ (key >> 32)) & mask;
+
+    while (fleet->entry[i].key != 0 &&
+           (fleet->entry[i].key != key || memcmp(&fleet->entry[i].prom, pRec, sizeof(*pRec)) != 0)) i = (i + 1) & mask;
+    return &fleet->entry[i];
+}
+
+/* Distance test against the running distribution, Welford update when inside */
+static uint8_t MS5611_FleetCheck(MS5611_FleetHeader_t* h, const MS5611_PromRecord_t* pRec){
+    if (h->n >= MS5611_FLEET_MIN)
+    {
+        for (uint8_t c = 0; c < 6; c++)
+        {
+            double sd = sqrt(h->m2[c] / (double)(h->n - 1));
+            if (fabs((double)pRec->word[c + 1] - h->mean[c]) > MS5611_FLEET_SIGMA * sd) return MS5611_FLEET_OUTLIER;
+        }
+    }
+    h->n++;
+    for (uint8_t c = 0; c < 6; c++)
+    {
+        double d = (double)pRec->word[c + 1] - h->mean[c];
+        h->mean[c] += d / (double)h->n;
+        h->m2[c] += d * ((double)pRec->word[c + 1] - h->mean[c]);
+    }
+    return 0;
+}
+
+uint8_t MS5611_FleetAdd(MS5611_Fleet_t* fleet, const MS5611_PromRecord_t* pRec, uint32_t unit, const MS5611_FleetEntry_t** pEntry){
+    MS5611_FleetHeader_t* h = fleet->header;
+    uint64_t key = MS5611_FleetKey(pRec);
+    MS5611_FleetEntry_t* e = MS5611_FleetSlot(fleet, key, pRec);
+    uint8_t flags;
+
+    if (pEntry) *pEntry = NULL;
+    if (e->key != 0)
+    {
+        /* Same unit re-provisioned is not a duplicate */
+        flags = e->flags & MS5611_FLEET_OUTLIER;
+        if (e->unit != unit) flags |= MS5611_FLEET_DUPLICATE;
+        if (e->seen < UINT16_MAX) e->seen++;
+        if (pEntry) *pEntry = e;
+        return flags;
+    }
+
+    /* Load limit 7 / 8 keeps linear probe sequences short, and one slot always stays empty to end them */
+    if (h->count + 1 >= h->capacity || h->count + 1 > (uint64_t)h->capacity - (h->capacity >> 3)) return MS5611_FLEET_FULL;
+
+    flags = MS5611_FleetCheck(h, pRec);
+    e->prom = *pRec;
+    e->unit = unit;
+    e->seen = 1;
+    e->flags = flags;
+    e->key = key;
+    h->count++;
+    if (pEntry) *pEntry = e;
+    return flags;
+}
+
+const MS5611_FleetEntry_t* MS5611_FleetFind(const MS5611_Fleet_t* fleet, const MS5611_PromRecord_t* pRec){
+    uint64_t key = MS5611_FleetKey(pRec);
+    MS5611_FleetEntry_t* e = MS5611_FleetSlot(fleet, key, pRec);
+    return (e->key != 0) ? e : NULL;
+}
+
+void MS5611_FleetClose(MS5611_Fleet_t* fleet){
+    if (fleet->header == NULL) return;
+    msync(fleet->header, fleet->size, MS_SYNC);
+    munmap(fleet->header, fleet->size);
+    close(fleet->fd);
+    fleet->header = NULL;
+}
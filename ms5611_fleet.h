@@ -0,0 +1,124 @@
+/*
+ *  ms5611_fleet.h
+ *
+ *  Created on: Oct 17, 2026
+ *  Author: agent
+ *
+ *  MS5611 calibration database for fleet provisioning (Linux / POSIX host).
+ *  PROM records (MS5611_PromDump) are stored in a memory mapped open
+ *  addressing hash file keyed by the PROM fingerprint. Lookups touch one or
+ *  a few cache lines, so millions of units fit in one file.
+ *  At insert a record is flagged as duplicate when the same PROM is already
+ *  registered to another unit (cloned or relabelled part), and as outlier
+ *  when a coefficient is far from the running fleet distribution.
+ *
+ *  Updates and bug reports :  @ https://github.com/Berkin99/MS5611
+ *
+ */
+
+#ifndef MS5611_FLEET_H_
+#define MS5611_FLEET_H_
+
+#include <stddef.h>
+#include "ms5611.h"
+
+#define MS5611_FLEET_MAGIC      0x4D534642UL
+#define MS5611_FLEET_SLOTS_MIN  8U              /* Smallest table, the load limit needs capacity / 8 >= 1 */
+#define MS5611_FLEET_SLOTS_MAX  0x80000000UL    /* Largest power of two slot count */
+
+#ifndef MS5611_FLEET_SIGMA
+#define MS5611_FLEET_SIGMA      6.0     /* Outlier distance (standard deviations) */
+#endif
+#ifndef MS5611_FLEET_MIN
+#define MS5611_FLEET_MIN        100     /* Records before outlier flagging starts */
+#endif
+
+/* MS5611_FleetAdd flags */
+#define MS5611_FLEET_DUPLICATE  0x01    /* PROM already registered to another unit */
+#define MS5611_FLEET_OUTLIER    0x02    /* C1..C6 out of the fleet distribution */
+#define MS5611_FLEET_FULL       0x04    /* Table at its load limit, not stored */
+
+typedef struct MS5611_FleetEntry_s
+{
+    uint64_t key;               /* PROM fingerprint, 0 for an empty slot */
+    MS5611_PromRecord_t prom;
+    uint32_t unit;              /* First unit id registered with this PROM */
+    uint16_t seen;              /* Provisioning count, saturating */
+    uint8_t flags;              /* Flags at first registration */
+    uint8_t reserved;
+}MS5611_FleetEntry_t;
+
+typedef struct MS5611_FleetHeader_s
+{
+    uint32_t magic;
+    uint32_t capacity;          /* Slot count, power of two */
+    uint64_t count;             /* Used slots */
+    uint64_t n;                 /* Records in the distribution */
+    double mean[6];             /* C1..C6 running mean */
+    double m2[6];               /* C1..C6 running sum of squared deviations */
+}MS5611_FleetHeader_t;
+
+typedef struct MS5611_Fleet_s
+{
+    MS5611_FleetHeader_t* header;
+    MS5611_FleetEntry_t* entry;
+    size_t size;                /* Mapped bytes */
+    int fd;
+}MS5611_Fleet_t;
+
+/*
+ * @brief Fingerprint of a PROM record (64 bit FNV-1a of the 8 words, never 0).
+ *
+ * @param[in] pRec : PROM record.
+ *
+ * @return uint64_t  : Fingerprint.
+ */
+uint64_t MS5611_FleetKey(const MS5611_PromRecord_t* pRec);
+
+/*
+ * @brief Opens a database file, creating it when it does not exist.
+ *
+ * @param[out] fleet    : Pointer to the handle.
+ * @param[in]  path     : File path.
+ * @param[in]  capacity : Slots for a new file, rounded up to a power of two
+ *                        between MS5611_FLEET_SLOTS_MIN and
+ *                        MS5611_FLEET_SLOTS_MAX (ignored for an existing
+ *                        file). Keep it above 1.25 x the expected unit count.
+ *
+ * @retval 0 -> Success
+ * @retval > 0 -> Failure
+ */
+int8_t MS5611_FleetOpen(MS5611_Fleet_t* fleet, const char* path, uint32_t capacity);
+
+/*
+ * @brief Registers a unit at provisioning time.
+ *
+ * @param[in]  fleet  : Handle.
+ * @param[in]  pRec   : PROM record of the unit.
+ * @param[in]  unit   : Fleet unit id.
+ * @param[out] pEntry : Stored entry (may be NULL, NULL when full).
+ *
+ * @return uint8_t  : MS5611_FLEET_* flags, 0 for a new in-distribution unit.
+ */
+uint8_t MS5611_FleetAdd(MS5611_Fleet_t* fleet, const MS5611_PromRecord_t* pRec, uint32_t unit, const MS5611_FleetEntry_t** pEntry);
+
+/*
+ * @brief Looks up a PROM record (fingerprint, confirmed on the full record).
+ *
+ * @param[in] fleet : Handle.
+ * @param[in] pRec  : PROM record.
+ *
+ * @return const MS5611_FleetEntry_t*  : Entry, NULL when unknown.
+ */
+const MS5611_FleetEntry_t* MS5611_FleetFind(const MS5611_Fleet_t* fleet, const MS5611_PromRecord_t* pRec);
+
+/*
+ * @brief Flushes and unmaps the database.
+ *
+ * @param[in] fleet : Handle.
+ *
+ * @return void
+ */
+void MS5611_FleetClose(MS5611_Fleet_t* fleet);
+
+#endif /* MS5611_FLEET_H_ */
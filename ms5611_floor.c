@@ -0,0 +1,189 @@
+/*
+ *  ms5611_floor.c
+ *
+ *  Created on: Oct 17, 2026
+ *  Author: agent
+ *
+ *  MS5611 floor level detection for indoor positioning.
+ *
+ *  Updates and bug reports :  @ https://github.com/Berkin99/MS5611
+ *
+ */
+
+#include <math.h>
+#include "ms5611_floor.h"
+
+void MS5611_FloorInit(MS5611_Floor_t* fl, const MS5611_FloorParams_t* params){
+    fl->params = params;
+    fl->floor = 0;
+    fl->pending = -1.0f;
+    fl->sum = 0;
+    fl->count = 0;
+    fl->started = 0;
+}
+
+/* One decimated step : smoothing, reference tracking and candidate state */
+static int8_t MS5611_FloorStep(MS5611_Floor_t* fl, float p, float dt){
+    const MS5611_FloorParams_t* k = fl->params;
+    float dev, floors;
+    int8_t change = 0;
+
+    if (!(dt > 0.0f)) return 0;     /* Repeated timestamp (no transport clock) : the loop gains divide by dt */
+
+    fl->smooth += (p - fl->smooth) * (1.0f - expf(-dt / k->tauShort));
+    dev = (fl->ref - fl->smooth) / fl->floorPa;     /* Floors above the reference */
+
+    if (fl->pending < 0.0f)
+    {
+        if (fabsf(dev) > k->enter)
+        {
+            fl->pending = 0.0f;
+            fl->anchor = fl->smooth;
+        }
+        else
+        {
+            /* Critically damped alpha-beta loop : follows a weather ramp without lag */
+            float e = fl->smooth - fl->ref;
+            float w = dt / k->tauRef;
+            fl->ref += fl->rate * dt + 2.0f * w * e;
+            fl->rate += w * w * e / dt;
+        }
+        return 0;
+    }
+    fl->ref += fl->rate * dt;   /* Weather keeps going during the candidate */
+
+    if (fabsf(dev) < k->exit)
+    {
+        fl->pending = -1.0f;
+        return 0;
+    }
+    /* Still moving : restart the settle time */
+    if (fabsf(fl->smooth - fl->anchor) > MS5611_FLOOR_SETTLE * fl->floorPa)
+    {
+        fl->anchor = fl->smooth;
+        fl->pending = 0.0f;
+        return 0;
+    }
+    fl->pending += dt;
+    if (fl->pending < k->hold) return 0;
+
+    floors = roundf(dev);
+    fl->pending = -1.0f;
+    if (floors == 0.0f) return 0;
+    change = (int8_t)floors;
+    fl->floor += change;
+    fl->ref = fl->smooth;
+    return change;
+}
+
+int8_t MS5611_FloorUpdate(MS5611_Floor_t* fl, uint32_t timestamp, int32_t pressure){
+    float p, dt;
+
+    fl->sum += pressure;
+    if (++fl->count < fl->params->decim) return 0;
+
+    p = (float)fl->sum / (float)fl->count;
+    fl->sum = 0;
+    fl->count = 0;
+
+    if (!fl->started)
+    {
+        fl->floorPa = fl->params->height * p / MS5611_FLOOR_SCALE_H;
+        fl->smooth = p;
+        fl->ref = p;
+        fl->rate = 0.0f;
+        fl->last = timestamp;
+        fl->started = 1;
+        return 0;
+    }
+    dt = (float)(timestamp - fl->last) * 1e-6f;
+    fl->last = timestamp;
+    return MS5611_FloorStep(fl, p, dt);
+}
+
+/* Simulation */
+
+static uint32_t MS5611_FloorRand(uint32_t* s){
+    *s ^= *s << 13;
+    *s ^= *s >> 17;
+    *s ^= *s << 5;
+    return *s;
+}
+
+static float MS5611_FloorUniform(uint32_t* s){
+    return ((float)(MS5611_FloorRand(s) >> 8) + 0.5f) * (1.0f / 16777216.0f);
+}
+
+static float MS5611_FloorGauss(uint32_t* s){
+    return sqrtf(-2.0f * logf(MS5611_FloorUniform(s))) * cosf(6.2831853f * MS5611_FloorUniform(s));
+}
+
+void MS5611_FloorSimulate(const MS5611_FloorParams_t* params, const MS5611_FloorScenario_t* sc, MS5611_FloorResult_t* pRes){
+    MS5611_Floor_t fl;
+    uint32_t seed = sc->seed ? sc->seed : 1;
+    uint32_t samples = (uint32_t)(sc->hours * 3600.0f * sc->rateHz);
+    double dt = 1.0 / sc->rateHz;
+    double paPerM = 101325.0 / MS5611_FLOOR_SCALE_H;
+    double nextMove = -log(MS5611_FloorUniform(&seed)) * 3600.0 / sc->changes;
+    double nextGust = (sc->gusts > 0.0f) ? -log(MS5611_FloorUniform(&seed)) * 3600.0 / sc->gusts : 1e30;
+    double alt = 0.0, target = 0.0, moveEnd = -1.0, gustT = -1e30, latencySum = 0.0;
+    int32_t floorTrue = 0;
+    uint8_t open = 0;           /* True change waiting for its report */
+
+    pRes->changes = pRes->detected = pRes->missed = pRes->falsePos = 0;
+    pRes->latencyMax = 0.0f;
+    MS5611_FloorInit(&fl, params);
+
+    for (uint32_t i = 0; i < samples; i++)
+    {
+        double t = i * dt;
+
+        if (t >= nextMove && alt == target)
+        {
+            int32_t step = 1 + (int32_t)(MS5611_FloorRand(&seed) % 3);
+            if ((floorTrue + step > 10) || ((floorTrue - step >= 0) && (MS5611_FloorRand(&seed) & 1))) step = -step;
+            if (open) pRes->missed++;
+            floorTrue += step;
+            target = floorTrue * params->height;
+            moveEnd = t + fabs(step * params->height) / sc->speed;
+            pRes->changes++;
+            open = 1;
+            nextMove = moveEnd - log(MS5611_FloorUniform(&seed)) * 3600.0 / sc->changes;
+        }
+        if (alt != target)
+        {
+            double v = sc->speed * dt;
+            alt = (fabs(target - alt) <= v) ? target : alt + ((target > alt) ? v : -v);
+        }
+        if (t >= nextGust)
+        {
+            gustT = t;
+            nextGust = t - log(MS5611_FloorUniform(&seed)) * 3600.0 / sc->gusts;
+        }
+
+        /* Weather : 12 h sine with a peak slope of drift Pa/h */
+        double weather = sc->drift / 3600.0 * (43200.0 / 6.2831853) * sin(t * (6.2831853 / 43200.0));
+        double p = 101325.0 + weather - paPerM * alt + sc->noise * MS5611_FloorGauss(&seed)
+                 + sc->gustPa * exp(-(t - gustT) / 2.0);
+
+        /* 32 bit us clock, wraps every 71.6 min like a transport timestamp */
+        int8_t change = MS5611_FloorUpdate(&fl, (uint32_t)(uint64_t)(t * 1e6), (int32_t)lround(p));
+        if (change == 0) continue;
+
+        if (open && (fl.floor == floorTrue))
+        {
+            float latency = (float)(t - moveEnd);
+            latencySum += latency;
+            if (latency > pRes->latencyMax) pRes->latencyMax = latency;
+            pRes->detected++;
+            open = 0;
+        }
+        else pRes->falsePos++;
+        /* Resynchronize, a wrong floor would otherwise count every later change */
+        fl.floor = floorTrue;
+    }
+    if (open) pRes->missed++;
+
+    pRes->latencyMean = pRes->detected ? (float)(latencySum / pRes->detected) : 0.0f;
+    pRes->fpPerHour = (float)pRes->falsePos / sc->hours;
+}
@@ -0,0 +1,120 @@
+/*
+ *  ms5611_floor.h
+ *
+ *  Created on: Oct 17, 2026
+ *  Author: agent
+ *
+ *  MS5611 floor level detection for indoor positioning.
+ *  Raw samples at a low OSR are block averaged (decimation), smoothed, and
+ *  compared with a slow reference that follows weather drift on the
+ *  current floor (second order loop, no lag on a steady weather trend).
+ *  A deviation beyond `enter` floors starts a candidate, it
+ *  is committed once the pressure has settled for `hold` seconds (stairs
+ *  and multi floor elevator rides end as one change) and dropped when the
+ *  deviation falls back under `exit` floors. The reference is frozen while
+ *  a candidate is pending and re-based on the new floor after a change.
+ *
+ *  Updates and bug reports :  @ https://github.com/Berkin99/MS5611
+ *
+ */
+
+#ifndef MS5611_FLOOR_H_
+#define MS5611_FLOOR_H_
+
+#include "ms5611.h"
+
+#define MS5611_FLOOR_OSR      MS5611_ULTRA_LOW_POWER    /* Suggested OSR, noise is removed by decimation */
+#define MS5611_FLOOR_SCALE_H  8430.0f                   /* Isothermal scale height (m) : dP/dh = -P / H */
+#define MS5611_FLOOR_SETTLE   0.12f                     /* Movement (floors) that restarts the settle time */
+
+typedef struct MS5611_FloorParams_s
+{
+    float height;               /* Floor to floor height (m) */
+    uint8_t decim;              /* Raw samples per block average */
+    float tauShort;             /* Smoothing of the block averages (s) */
+    float tauRef;               /* Reference tracker (s), slower than any floor change */
+    float enter;                /* Candidate threshold (floors) */
+    float exit;                 /* Candidate drop threshold (floors), < enter */
+    float hold;                 /* Settled time before a change is committed (s) */
+}MS5611_FloorParams_t;
+
+/* 3 m floors, 16 Hz raw rate -> 2 Hz blocks */
+#define MS5611_FLOOR_DEFAULT  {3.0f, 8, 1.0f, 600.0f, 0.6f, 0.35f, 3.0f}
+
+typedef struct MS5611_Floor_s
+{
+    const MS5611_FloorParams_t* params;
+    int32_t floor;              /* Current floor, relative to the start */
+    float floorPa;              /* Pressure of one floor (Pa) */
+    float smooth;               /* Smoothed block average (Pa) */
+    float ref;                  /* Reference of the current floor (Pa) */
+    float rate;                 /* Reference drift (Pa/s) */
+    float anchor;               /* Candidate settle anchor (Pa) */
+    float pending;              /* Candidate settled time (s), < 0 when idle */
+    int64_t sum;                /* Block accumulator (Pa) */
+    uint8_t count;              /* Samples in the block */
+    uint32_t last;              /* Previous block timestamp (us) */
+    uint8_t started;
+}MS5611_Floor_t;
+
+typedef struct MS5611_FloorScenario_s
+{
+    float hours;                /* Simulated time */
+    float rateHz;               /* Raw sample rate */
+    float noise;                /* Raw sample noise RMS (Pa), 6.5 at OSR 256 */
+    float drift;                /* Weather drift (Pa/h), peak slope of a 12 h sine */
+    float changes;              /* Floor changes per hour */
+    float speed;                /* Vertical speed (m/s), ~0.3 stairs, ~1.5 elevator */
+    float gusts;                /* Door / HVAC transients per hour */
+    float gustPa;               /* Transient amplitude (Pa), 2 s decay */
+    uint32_t seed;
+}MS5611_FloorScenario_t;
+
+typedef struct MS5611_FloorResult_s
+{
+    uint32_t changes;           /* True floor changes */
+    uint32_t detected;          /* Changes reported with the right floor */
+    uint32_t missed;
+    uint32_t falsePos;          /* Reported changes without a matching true change */
+    float latencyMean;          /* End of movement to report (s) */
+    float latencyMax;
+    float fpPerHour;
+}MS5611_FloorResult_t;
+
+/*
+ * @brief Initializes the detector on floor 0.
+ *
+ * @param[out] fl     : Pointer to the detector.
+ * @param[in]  params : Tuning, e.g. a MS5611_FLOOR_DEFAULT initialized struct.
+ *
+ * @return void
+ */
+void MS5611_FloorInit(MS5611_Floor_t* fl, const MS5611_FloorParams_t* params);
+
+/*
+ * @brief Adds one raw sample. The detector runs once per decim samples.
+ *
+ * @param[in] fl        : Pointer to the detector.
+ * @param[in] timestamp : Sample timestamp (us), wrap around safe. A block
+ *                        with the timestamp of the previous one is skipped.
+ * @param[in] pressure  : Pressure (Pa).
+ *
+ * @return int8_t  : Floors changed by this sample (positive up), 0 for none.
+ */
+int8_t MS5611_FloorUpdate(MS5611_Floor_t* fl, uint32_t timestamp, int32_t pressure);
+
+/*
+ * @brief Runs the detector on a synthetic building scenario : random floor
+ *        changes at a vertical speed, weather drift, sensor noise and
+ *        pressure transients, and scores detection latency and false
+ *        positives against the ground truth.
+ *
+ * @param[in]  params : Detector tuning.
+ * @param[in]  sc     : Scenario.
+ * @param[out] pRes   : Scores.
+ *
+ * @return void
+ */
+void MS5611_FloorSimulate(const MS5611_FloorParams_t* params, const MS5611_FloorScenario_t* sc, MS5611_FloorResult_t* pRes);
+
+#endif /* MS5611_FLOOR_H_ */
@@ -0,0 +1,60 @@
+/*
+ *  ms5611_heat.c
+ *
+ *  Created on: Oct 17, 2026
+ *  Author: agent
+ *
+ *  MS5611 warm-up and self-heating compensation.
+ *
+ *  Updates and bug reports :  @ https://github.com/Berkin99/MS5611
+ *
+ */
+
+#include <stddef.h>
+#include <math.h>
+#include "ms5611_heat.h"
+
+int8_t MS5611_HeatInit(MS5611_Heat_t* heat, const MS5611_HeatParams_t* params, uint32_t boot){
+    if (!(params->tauHeat > 0.0f) || !(params->tauWarm > 0.0f)) return MS5611_ERROR;
+
+    heat->params = params;
+    heat->last = boot;
+    heat->uptime = 0.0f;
+    heat->rise = 0.0f;
+    heat->offset = 0.0f;
+    return MS5611_OK;
+}
+
+void MS5611_HeatApply(MS5611_Heat_t* heat, const MS5611_Device_t* dev, MS5611_Sample_t* pSample, uint8_t conversions){
+    const MS5611_HeatParams_t* k = heat->params;
+    float elapsed = (float)(pSample->timestamp - heat->last) * 1e-6f;
+    float busy = (float)conversions * (float)dev->config.ct * 1e-3f;
+    float duty = (elapsed > busy) ? busy / elapsed : 1.0f;
+
+    /* Accumulated, the 32 bit us clock wraps every 71.6 min */
+    heat->uptime += elapsed;
+    if (heat->uptime > MS5611_HEAT_UPTIME_MAX * k->tauWarm) heat->uptime = MS5611_HEAT_UPTIME_MAX * k->tauWarm;
+
+    heat->rise += (k->kDuty * duty - heat->rise) * (1.0f - expf(-elapsed / k->tauHeat));
+    heat->offset = heat->rise + k->warm0 * expf(-heat->uptime / k->tauWarm);
+    heat->last = pSample->timestamp;
+
+    pSample->data.temperature -= (int32_t)lroundf(heat->offset);
+    pSample->data.pressure -= (int32_t)lroundf(k->kPress * heat->offset);
+}
+
+#ifdef MS5611_HEAT
+void MS5611_HeatAttach(MS5611_Device_t* dev, MS5611_Heat_t* heat){
+    dev->heat = heat;
+}
+
+void MS5611_HeatHook(const MS5611_Device_t* dev, MS5611_Data_t* pData, uint32_t timestamp, uint8_t conversions){
+    MS5611_Sample_t sample;
+
+    if (dev->heat == NULL) return;
+    sample.timestamp = timestamp;
+    sample.data = *pData;
+    MS5611_HeatApply(dev->heat, dev, &sample, conversions);
+    *pData = sample.data;
+}
+#endif
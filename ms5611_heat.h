@@ -0,0 +1,116 @@
+/*
+ *  ms5611_heat.h
+ *
+ *  Created on: Oct 17, 2026
+ *  Author: agent
+ *
+ *  MS5611 warm-up and self-heating compensation.
+ *  The die temperature rise is modeled as
+ *      rise  = first order lag (tauHeat) of kDuty * conversion duty cycle
+ *      warm  = warm0 * exp(-time since power-up / tauWarm)
+ *      dT    = rise + warm              (centi-degC)
+ *      dP    = kPress * dT              (Pa)
+ *  and subtracted from each sample. Coefficients are board dependent :
+ *  log D2 / pressure at constant ambient after power-up at two sample
+ *  rates and fit warm0, tauWarm, kDuty, tauHeat and kPress.
+ *  MS5611_HEAT_PARAMS_DEFAULT is a starting point for a bare breakout board.
+ *
+ *  Either call MS5611_HeatApply on each sample, or build with MS5611_HEAT
+ *  and attach the model to the device : the driver sample paths then
+ *  correct every sample through MS5611_HEAT_HOOK (needs the transport
+ *  timestamp op).
+ *
+ *  Updates and bug reports :  @ https://github.com/Berkin99/MS5611
+ *
+ */
+
+#ifndef MS5611_HEAT_H_
+#define MS5611_HEAT_H_
+
+#include "ms5611.h"
+
+#define MS5611_HEAT_UPTIME_MAX    8     /* Warm-up term is negligible past 8 tauWarm (exp(-8) = 3e-4) */
+
+/* kDuty, tauHeat, warm0, tauWarm, kPress : breakout board in still air, refit per board */
+#define MS5611_HEAT_PARAMS_DEFAULT  { 40.0f, 20.0f, 25.0f, 90.0f, 0.3f }
+
+typedef struct MS5611_HeatParams_s
+{
+    float kDuty;                /* Steady rise at 100 % duty (centi-degC) */
+    float tauHeat;              /* Thermal time constant (s) */
+    float warm0;                /* Warm-up offset at power-up (centi-degC) */
+    float tauWarm;              /* Warm-up time constant (s) */
+    float kPress;               /* Pressure drift per centi-degC of self heating (Pa) */
+}MS5611_HeatParams_t;
+
+typedef struct MS5611_Heat_s
+{
+    const MS5611_HeatParams_t* params;
+    uint32_t last;              /* Previous sample timestamp (us) */
+    float uptime;               /* Time since power-up (s), saturates at MS5611_HEAT_UPTIME_MAX tauWarm */
+    float rise;                 /* Lagged duty rise (centi-degC) */
+    float offset;               /* Last applied temperature offset (centi-degC) */
+}MS5611_Heat_t;
+
+/*
+ * @brief Starts the model at power-up (call next to MS5611_Init).
+ *
+ * @param[out] heat   : Pointer to the model.
+ * @param[in]  params : Board coefficients.
+ * @param[in]  boot   : Power-up timestamp (us), same clock as the samples.
+ *
+ * @retval 0 -> Success
+ * @retval > 0 -> Failure, tauHeat or tauWarm is not positive
+ */
+int8_t MS5611_HeatInit(MS5611_Heat_t* heat, const MS5611_HeatParams_t* params, uint32_t boot);
+
+/*
+ * @brief Updates the model with one sample and removes the predicted
+ *        self heating offset from its data. Samples are expected at least
+ *        every 71 min (timestamp wrap), the uptime is accumulated from the
+ *        sample intervals.
+ *
+ * @param[in]     heat        : Pointer to the model.
+ * @param[in]     dev         : Device that produced the sample (conversion time).
+ * @param[in,out] pSample     : Sample with timestamp, data is corrected.
+ * @param[in]     conversions : Conversions since the previous sample : 2 for
+ *                              MS5611_GetData / MS5611_Poll / arrays, 1 for a
+ *                              MS5611_GetDataBy sample on cached D2, 1 in
+ *                              continuous mode (2 right after a temperature
+ *                              conversion).
+ *
+ * @return void
+ */
+void MS5611_HeatApply(MS5611_Heat_t* heat, const MS5611_Device_t* dev, MS5611_Sample_t* pSample, uint8_t conversions);
+
+#ifdef MS5611_HEAT
+/*
+ * @brief Attaches an initialized model to the device, the driver sample
+ *        paths then correct each sample. NULL detaches.
+ *
+ * @param[in,out] dev  : Pointer to the MS5611 device structure.
+ * @param[in]     heat : Pointer to the model (MS5611_HeatInit), or NULL.
+ *
+ * @return void
+ */
+void MS5611_HeatAttach(MS5611_Device_t* dev, MS5611_Heat_t* heat);
+
+/*
+ * @brief Sample path hook : corrects pData with the attached model, no-op
+ *        when none is attached.
+ *
+ * @param[in]     dev         : Device that produced the sample.
+ * @param[in,out] pData       : Compensated sample.
+ * @param[in]     timestamp   : Sample timestamp (us).
+ * @param[in]     conversions : See MS5611_HeatApply.
+ *
+ * @return void
+ */
+void MS5611_HeatHook(const MS5611_Device_t* dev, MS5611_Data_t* pData, uint32_t timestamp, uint8_t conversions);
+
+#define MS5611_HEAT_HOOK(dev, pData, timestamp, conversions)    MS5611_HeatHook((dev), (pData), (timestamp), (conversions))
+#else
+#define MS5611_HEAT_HOOK(dev, pData, timestamp, conversions)    ((void)0)
+#endif
+
+#endif /* MS5611_HEAT_H_ */
@@ -0,0 +1,174 @@
+/*
+ *  ms5611_model.c
+ *
+ *  Created on: Oct 17, 2026
+ *  Author: agent
+ *
+ *  MS5611 acquisition performance model.
+ *
+ *  Updates and bug reports :  @ https://github.com/Berkin99/MS5611
+ *
+ */
+
+#include <stddef.h>
+#include "ms5611_model.h"
+#include "ms5611_array.h"
+#include "ms5611_sim.h"
+
+#define MS5611_MODEL_SIM_MAX    16
+
+/* Conversion wait of the driver (ms), see MS5611_SetOSRate */
+static uint32_t MS5611_ModelCtNs(const MS5611_ModelParams_t* params){
+    MS5611_Device_t dev = {0};
+    MS5611_SetOSRate(&dev, params->osRate);
+    return (uint32_t)dev.config.ct * 1000000UL;
+}
+
+uint32_t MS5611_ModelXferNs(const MS5611_ModelParams_t* params, uint8_t rxLen){
+    uint32_t bits;
+
+    if (params->bus == MS5611_MODEL_SPI)
+    {
+        bits = 8U * (1U + rxLen);                           /* One CS frame */
+    }
+    else
+    {
+        bits = 2U + 9U * 2U;                                /* START, address + W, command, STOP */
+        if (rxLen) bits += 1U + 9U * (1U + rxLen);          /* Repeated START, address + R, data */
+    }
+    return params->overheadNs + (uint32_t)(((uint64_t)bits * 1000000000ULL) / params->clockHz);
+}
+
+void MS5611_ModelPredict(const MS5611_ModelParams_t* params, MS5611_ModelMode_e mode, uint8_t n, MS5611_ModelResult_t* pRes){
+    double ct = MS5611_ModelCtNs(params);
+    double phaseBus = (double)MS5611_ModelXferNs(params, 0) + MS5611_ModelXferNs(params, 3);   /* Convert + ADC read */
+    double period;                                                                               /* ns per sample per sensor */
+
+    switch (mode)
+    {
+    case MS5611_MODE_POLL:
+        /* A phase waits ct + 1 ms ticks, sensors drift apart once the bus is the limit */
+        period = 2.0 * ((ct + 1e6 > n * phaseBus) ? ct + 1e6 : n * phaseBus);
+        break;
+    case MS5611_MODE_ARRAY:
+        period = 2.0 * (ct + n * phaseBus);
+        break;
+    default:
+        period = 2.0 * (ct + phaseBus) * n;
+        break;
+    }
+
+    pRes->perSensorRate = (float)(1e9 / period);
+    pRes->sampleRate = pRes->perSensorRate * n;
+    pRes->busNsPerSample = (uint32_t)(2.0 * phaseBus);
+    pRes->busUtilization = (float)(pRes->sampleRate * 2.0 * phaseBus / 1e9);
+    /* MS5611_Init : reset, reload wait, PROM burst of 8 words */
+    pRes->initNs = MS5611_ModelXferNs(params, 0) + MS5611_RESET_MS * 1000000UL + 8UL * MS5611_ModelXferNs(params, 2);
+}
+
+uint8_t MS5611_ModelMaxSensors(const MS5611_ModelParams_t* params, MS5611_ModelMode_e mode){
+    MS5611_ModelResult_t one, res;
+    uint8_t n;
+
+    MS5611_ModelPredict(params, mode, 1, &one);
+    for (n = 1; n < 255; n++)
+    {
+        MS5611_ModelPredict(params, mode, n + 1, &res);
+        if (res.perSensorRate < 0.9f * one.perSensorRate || res.busUtilization >= 1.0f) break;
+    }
+    /* Two addresses (CSB pin) without a multiplexer */
+    if (params->bus == MS5611_MODEL_I2C && n > 2) n = 2;
+    return n;
+}
+
+/* Simulated bus (ms5611_sim.h) : virtual clock, modeled transfer times */
+
+#ifndef MS5611_STATIC_INTF
+static uint32_t MS5611_ModelSimXferNs(const void* ctx, uint8_t rxLen){
+    return MS5611_ModelXferNs((const MS5611_ModelParams_t*)ctx, rxLen);
+}
+#endif
+
+int8_t MS5611_ModelSimulate(const MS5611_ModelParams_t* params, MS5611_ModelMode_e mode, uint8_t n, uint32_t samples, MS5611_ModelResult_t* pRes){
+#ifdef MS5611_STATIC_INTF
+    (void)params; (void)mode; (void)n; (void)samples; (void)pRes;
+    return MS5611_ERROR;        /* The simulated bus needs the ops table */
+#else
+    MS5611_Sim_t sim;
+    MS5611_SimPart_t parts[MS5611_MODEL_SIM_MAX];
+    MS5611_Device_t devs[MS5611_MODEL_SIM_MAX];
+    uint64_t start, busyStart;
+    uint32_t total = 0;
+    int8_t rslt = MS5611_OK;
+
+    if (n == 0 || n > MS5611_MODEL_SIM_MAX || samples == 0) return MS5611_ERROR;
+    MS5611_SimInit(&sim, MS5611_SIM_VIRTUAL, MS5611_ModelSimXferNs, params);
+
+    for (uint8_t i = 0; i < n; i++)
+    {
+        MS5611_SimAttach(&sim, &parts[i]);
+        devs[i] = MS5611_NewDevice(&parts[i], &MS5611_SimOps);
+        start = sim.clock;
+        rslt |= MS5611_Init(&devs[i]);
+        pRes->initNs = (uint32_t)(sim.clock - start);
+        MS5611_SetOSRate(&devs[i], params->osRate);
+    }
+    start = sim.clock;
+    busyStart = sim.busy;
+
+    if (mode == MS5611_MODE_ARRAY)
+    {
+        MS5611_Array_t arr;
+        rslt |= MS5611_ArrayInit(&arr, devs, n);
+        for (uint32_t s = 0; s < samples && rslt == MS5611_OK; s++) rslt |= MS5611_ArrayGetData(&arr);
+        total = samples * n;
+    }
+#ifndef MS5611_NO_POLL
+    else if (mode == MS5611_MODE_POLL)
+    {
+        uint32_t done[MS5611_MODEL_SIM_MAX] = {0};
+
+        while (total < samples * n)
+        {
+            uint64_t busy = sim.busy;
+            for (uint8_t i = 0; i < n; i++)
+            {
+                if (done[i] < samples && MS5611_Poll(&devs[i], (uint32_t)(sim.clock / 1000000ULL)) == MS5611_OK)
+                {
+                    done[i]++;
+                    total++;
+                }
+            }
+            /* Idle superloop : jump to the next millisecond tick */
+            if (sim.busy == busy) sim.clock = (sim.clock / 1000000ULL + 1) * 1000000ULL;
+        }
+    }
+#else
+    else if (mode == MS5611_MODE_POLL)
+    {
+        return MS5611_ERROR;    /* MS5611_Poll is not in this build */
+    }
+#endif
+    else
+    {
+        for (uint32_t s = 0; s < samples; s++)
+        {
+            for (uint8_t i = 0; i < n; i++)
+            {
+                MS5611_Output_t out;
+                rslt |= MS5611_GetDataAs(&devs[i], MS5611_FMT_INT, &out);
+                total++;
+            }
+        }
+    }
+
+    /* A read before the conversion end means the driver waits too little */
+    if (sim.early != 0) rslt = MS5611_ERROR;
+
+    pRes->sampleRate = (float)((double)total * 1e9 / (double)(sim.clock - start));
+    pRes->perSensorRate = pRes->sampleRate / n;
+    pRes->busUtilization = (float)((double)(sim.busy - busyStart) / (double)(sim.clock - start));
+    pRes->busNsPerSample = (uint32_t)((sim.busy - busyStart) / total);
+    return rslt;
+#endif
+}
@@ -0,0 +1,108 @@
+/*
+ *  ms5611_model.h
+ *
+ *  Created on: Oct 17, 2026
+ *  Author: agent
+ *
+ *  MS5611 acquisition performance model.
+ *  Predicts the achievable sample rate and bus utilization for N sensors
+ *  from the bus clock, the transaction sizes the driver issues
+ *  (MS5611_Convert : cmd, MS5611_AdcRead : cmd + 3 bytes,
+ *  MS5611_ReadPROM : cmd + 2 bytes) and the OSR conversion time.
+ *
+ *  MS5611_ModelSimulate runs the public driver API (MS5611_Init,
+ *  MS5611_GetDataAs, MS5611_Poll, MS5611_ArrayGetData) over the shared
+ *  simulated bus (ms5611_sim.h) so the model can be checked against the
+ *  actual call pattern of each acquisition mode, waits included.
+ *
+ *  Updates and bug reports :  @ https://github.com/Berkin99/MS5611
+ *
+ */
+
+#ifndef MS5611_MODEL_H_
+#define MS5611_MODEL_H_
+
+#include "ms5611.h"
+
+typedef enum
+{
+    MS5611_MODEL_I2C = 0,
+    MS5611_MODEL_SPI
+}MS5611_ModelBus_e;
+
+typedef enum
+{
+    MS5611_MODE_BLOCKING = 0,   /* MS5611_GetDataAs, sensors one after another */
+    MS5611_MODE_POLL,           /* MS5611_Poll, conversions overlap across sensors */
+    MS5611_MODE_ARRAY           /* MS5611_ArrayGetData, pipelined SPI transfer list */
+}MS5611_ModelMode_e;
+
+typedef struct MS5611_ModelParams_s
+{
+    MS5611_ModelBus_e bus;
+    uint32_t clockHz;           /* SCL / SCK frequency */
+    uint32_t overheadNs;        /* Per transaction software / CS setup cost */
+    MS5611_OSRate_t osRate;
+}MS5611_ModelParams_t;
+
+typedef struct MS5611_ModelResult_s
+{
+    float sampleRate;           /* Aggregate complete samples (D1 + D2) per second */
+    float perSensorRate;        /* Samples per second per sensor */
+    float busUtilization;       /* 0..1 */
+    uint32_t busNsPerSample;    /* Bus time per complete sample */
+    uint32_t initNs;            /* MS5611_Init of one sensor : reset, reload wait, PROM burst */
+}MS5611_ModelResult_t;
+
+/*
+ * @brief Transaction time on the modeled bus.
+ *
+ * @param[in] params : Model parameters.
+ * @param[in] rxLen  : Response bytes after the command byte (0 for commands).
+ *
+ * @return uint32_t  : Nanoseconds.
+ */
+uint32_t MS5611_ModelXferNs(const MS5611_ModelParams_t* params, uint8_t rxLen);
+
+/*
+ * @brief Predicts throughput for N sensors in an acquisition mode.
+ *
+ * @param[in]  params : Model parameters.
+ * @param[in]  mode   : Acquisition mode.
+ * @param[in]  n      : Number of sensors.
+ * @param[out] pRes   : Prediction.
+ *
+ * @return void
+ */
+void MS5611_ModelPredict(const MS5611_ModelParams_t* params, MS5611_ModelMode_e mode, uint8_t n, MS5611_ModelResult_t* pRes);
+
+/*
+ * @brief Largest sensor count whose aggregate rate still grows linearly,
+ *        i.e. the bus is not yet the bottleneck.
+ *
+ * @param[in] params : Model parameters.
+ * @param[in] mode   : Acquisition mode.
+ *
+ * @return uint8_t  : Sensors that fit on one bus (capped at 255).
+ */
+uint8_t MS5611_ModelMaxSensors(const MS5611_ModelParams_t* params, MS5611_ModelMode_e mode);
+
+/*
+ * @brief Runs the driver over the simulated bus and measures the same figures.
+ *        Use it to check MS5611_ModelPredict against the real call pattern.
+ *        Fails when the driver reads an ADC result before the conversion
+ *        end, with MS5611_STATIC_INTF (the simulated bus is an ops table),
+ *        and for MS5611_MODE_POLL with MS5611_NO_POLL.
+ *
+ * @param[in]  params  : Model parameters.
+ * @param[in]  mode    : Acquisition mode.
+ * @param[in]  n       : Number of sensors, up to 16.
+ * @param[in]  samples : Complete samples per sensor to acquire.
+ * @param[out] pRes    : Measurement.
+ *
+ * @retval 0 -> Success
+ * @retval > 0 -> Failure
+ */
+int8_t MS5611_ModelSimulate(const MS5611_ModelParams_t* params, MS5611_ModelMode_e mode, uint8_t n, uint32_t samples, MS5611_ModelResult_t* pRes);
+
+#endif /* MS5611_MODEL_H_ */
@@ -0,0 +1,60 @@
+/*
+ *  ms5611_rtos.c
+ *
+ *  Created on: Oct 17, 2026
+ *  Author: agent
+ *
+ *  MS5611 RTOS integration layer.
+ *
+ *  Updates and bug reports :  @ https://github.com/Berkin99/MS5611
+ *
+ */
+
+#include "ms5611_rtos.h"
+#include "ms5611_heat.h"
+
+void MS5611_RtosInit(MS5611_Rtos_t* rtos, MS5611_Device_t* dev, const MS5611_OsOps_t* os, void* queue){
+    rtos->dev = dev;
+    rtos->os = os;
+    rtos->queue = queue;
+    rtos->run = 1;
+    rtos->errors = 0;
+}
+
+void MS5611_RtosTask(void* arg){
+    MS5611_Rtos_t* rtos = (MS5611_Rtos_t*)arg;
+    MS5611_Device_t* dev = rtos->dev;
+    MS5611_Sample_t sample;
+
+    while (rtos->run)
+    {
+        int8_t rslt = MS5611_OK;
+
+        /* ct + 1 : a tick based sleep may return up to one tick early */
+        MS5611_Convert(dev, MS5611_CMD_CONV_D1);
+        rtos->os->sleep(dev->config.ct + 1);
+        rslt |= MS5611_AdcRead(dev, &sample.D1);
+        sample.timestamp = MS5611_Timestamp(dev);
+
+        MS5611_Convert(dev, MS5611_CMD_CONV_D2);
+        rtos->os->sleep(dev->config.ct + 1);
+        rslt |= MS5611_AdcRead(dev, &sample.D2);
+
+        if (rslt != MS5611_OK)
+        {
+            rtos->errors++;
+            continue;
+        }
+#ifndef MS5611_NO_D2_CACHE
+        dev->D2 = sample.D2;
+        dev->D2Stamp = sample.timestamp;
+#endif
+        sample.data = MS5611_RawDataProcess(dev, sample.D1, sample.D2, 1);
+        MS5611_HEAT_HOOK(dev, &sample.data, sample.timestamp, 2);
+        rtos->os->queueSend(rtos->queue, &sample);
+    }
+}
+
+int8_t MS5611_RtosRead(MS5611_Rtos_t* rtos, MS5611_Sample_t* pSample, uint32_t timeout){
+    return rtos->os->queueRecv(rtos->queue, pSample, timeout);
+}
@@ -0,0 +1,79 @@
+/*
+ *  ms5611_rtos.h
+ *
+ *  Created on: Oct 17, 2026
+ *  Author: agent
+ *
+ *  MS5611 RTOS integration layer.
+ *  Acquisition runs in its own task, conversion waits use the OS sleep
+ *  so other tasks get the CPU, samples are published through a queue.
+ *  The OS is reached through MS5611_OsOps_t (FreeRTOS, Zephyr, POSIX ...).
+ *
+ *  FreeRTOS sketch :
+ *      sleep     -> vTaskDelay(pdMS_TO_TICKS(ms))
+ *      queueSend -> xQueueOverwrite / xQueueSend(q, s, 0)
+ *      queueRecv -> xQueueReceive(q, s, pdMS_TO_TICKS(timeout))
+ *      xTaskCreate(MS5611_RtosTask, "baro", 256, &rtos, prio, NULL);
+ *
+ *  Updates and bug reports :  @ https://github.com/Berkin99/MS5611
+ *
+ */
+
+#ifndef MS5611_RTOS_H_
+#define MS5611_RTOS_H_
+
+#include "ms5611.h"
+
+#define MS5611_WAIT_FOREVER   0xFFFFFFFFUL
+
+typedef struct MS5611_OsOps_s
+{
+    void   (*sleep)(uint32_t ms);                                              /* Yielding delay */
+    int8_t (*queueSend)(void* queue, const MS5611_Sample_t* pSample);          /* Non-blocking */
+    int8_t (*queueRecv)(void* queue, MS5611_Sample_t* pSample, uint32_t timeout); /* Blocking with timeout (ms) */
+}MS5611_OsOps_t;
+
+typedef struct MS5611_Rtos_s
+{
+    MS5611_Device_t* dev;       /* Initialized device */
+    const MS5611_OsOps_t* os;
+    void* queue;
+    volatile uint8_t run;       /* Clear to stop the task */
+    uint32_t errors;            /* Failed acquisitions */
+}MS5611_Rtos_t;
+
+/*
+ * @brief Binds a device to an OS port and a sample queue.
+ *
+ * @param[out] rtos  : Pointer to the integration structure.
+ * @param[in]  dev   : Initialized device (MS5611_Init done).
+ * @param[in]  os    : OS port.
+ * @param[in]  queue : Queue handle passed to the OS port.
+ *
+ * @return void
+ */
+void MS5611_RtosInit(MS5611_Rtos_t* rtos, MS5611_Device_t* dev, const MS5611_OsOps_t* os, void* queue);
+
+/*
+ * @brief Acquisition task body, pass the MS5611_Rtos_t as task argument.
+ *        Returns when rtos->run is cleared.
+ *
+ * @param[in] arg  : Pointer to the integration structure.
+ *
+ * @return void
+ */
+void MS5611_RtosTask(void* arg);
+
+/*
+ * @brief Blocking read of the next published sample.
+ *
+ * @param[in]  rtos    : Pointer to the integration structure.
+ * @param[out] pSample : Sample.
+ * @param[in]  timeout : Milliseconds, MS5611_WAIT_FOREVER to block.
+ *
+ * @retval 0 -> Success
+ * @retval > 0 -> Timeout
+ */
+int8_t MS5611_RtosRead(MS5611_Rtos_t* rtos, MS5611_Sample_t* pSample, uint32_t timeout);
+
+#endif /* MS5611_RTOS_H_ */
@@ -0,0 +1,150 @@
+/*
+ *  ms5611_rtos_posix.c
+ *
+ *  Created on: Oct 17, 2026
+ *  Author: agent
+ *
+ *  POSIX (pthread) port of the MS5611 RTOS integration layer.
+ *
+ *  Updates and bug reports :  @ https://github.com/Berkin99/MS5611
+ *
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <time.h>
+#include <errno.h>
+#include "ms5611_rtos_posix.h"
+#include "ms5611_sim.h"
+
+static void MS5611_PosixSleep(uint32_t ms){
+    struct timespec ts = { .tv_sec = ms / 1000, .tv_nsec = (long)(ms % 1000) * 1000000L };
+    while (nanosleep(&ts, &ts) != 0 && errno == EINTR);
+}
+
+static int8_t MS5611_PosixSend(void* queue, const MS5611_Sample_t* pSample){
+    MS5611_PosixQueue_t* q = (MS5611_PosixQueue_t*)queue;
+
+    pthread_mutex_lock(&q->lock);
+    q->buffer[(q->head + q->count) % MS5611_POSIX_QUEUE_LEN] = *pSample;
+    if (q->count < MS5611_POSIX_QUEUE_LEN) q->count++;
+    else q->head = (q->head + 1) % MS5611_POSIX_QUEUE_LEN;
+    pthread_cond_signal(&q->cond);
+    pthread_mutex_unlock(&q->lock);
+    return MS5611_OK;
+}
+
+static int8_t MS5611_PosixRecv(void* queue, MS5611_Sample_t* pSample, uint32_t timeout){
+    MS5611_PosixQueue_t* q = (MS5611_PosixQueue_t*)queue;
+    struct timespec until;
+    int err = 0;
+
+    clock_gettime(CLOCK_MONOTONIC, &until);       /* Condvar clock, see MS5611_PosixQueueInit */
+    until.tv_sec += timeout / 1000;
+    until.tv_nsec += (long)(timeout % 1000) * 1000000L;
+    if (until.tv_nsec >= 1000000000L)
+    {
+        until.tv_sec++;
+        until.tv_nsec -= 1000000000L;
+    }
+
+    pthread_mutex_lock(&q->lock);
+    while (q->count == 0 && err == 0)
+    {
+        if (timeout == MS5611_WAIT_FOREVER) err = pthread_cond_wait(&q->cond, &q->lock);
+        else err = pthread_cond_timedwait(&q->cond, &q->lock, &until);
+    }
+    if (q->count == 0)
+    {
+        pthread_mutex_unlock(&q->lock);
+        return MS5611_ERROR;
+    }
+    *pSample = q->buffer[q->head];
+    q->head = (q->head + 1) % MS5611_POSIX_QUEUE_LEN;
+    q->count--;
+    pthread_mutex_unlock(&q->lock);
+    return MS5611_OK;
+}
+
+const MS5611_OsOps_t MS5611_PosixOs = {
+    .sleep = MS5611_PosixSleep,
+    .queueSend = MS5611_PosixSend,
+    .queueRecv = MS5611_PosixRecv
+};
+
+void MS5611_PosixQueueInit(MS5611_PosixQueue_t* queue){
+    pthread_condattr_t attr;
+
+    pthread_mutex_init(&queue->lock, NULL);
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);    /* Receive timeouts immune to wall clock steps */
+    pthread_cond_init(&queue->cond, &attr);
+    pthread_condattr_destroy(&attr);
+    queue->head = 0;
+    queue->count = 0;
+}
+
+void MS5611_PosixQueueDeinit(MS5611_PosixQueue_t* queue){
+    pthread_cond_destroy(&queue->cond);
+    pthread_mutex_destroy(&queue->lock);
+}
+
+static void* MS5611_PosixThread(void* arg){
+    MS5611_RtosTask(arg);
+    return NULL;
+}
+
+int8_t MS5611_PosixStart(MS5611_Rtos_t* rtos, pthread_t* thread){
+    return pthread_create(thread, NULL, MS5611_PosixThread, rtos) == 0 ? MS5611_OK : MS5611_ERROR;
+}
+
+/* Self check : simulated sensor (ms5611_sim.h) on CLOCK_MONOTONIC */
+
+int8_t MS5611_PosixSelfCheck(uint32_t samples){
+#ifdef MS5611_STATIC_INTF
+    (void)samples;
+    return MS5611_ERROR;        /* The simulated sensor needs the ops table */
+#else
+    MS5611_Ops_t ops = MS5611_SimOps;
+    MS5611_Sim_t sim;
+    MS5611_SimPart_t part;
+    MS5611_PosixQueue_t queue;
+    MS5611_Rtos_t rtos;
+    MS5611_Sample_t sample;
+    pthread_t thread;
+    uint32_t prev = 0;
+    int8_t rslt = MS5611_OK;
+
+    ops.delay = MS5611_PosixSleep;                      /* The realtime sim does not wait */
+    MS5611_SimInit(&sim, MS5611_SIM_REALTIME, NULL, NULL);
+    MS5611_SimAttach(&sim, &part);
+
+    MS5611_Device_t dev = MS5611_NewDevice(&part, &ops);
+    if (MS5611_Init(&dev) != MS5611_OK) return MS5611_ERROR;
+    MS5611_SetOSRate(&dev, MS5611_ULTRA_LOW_POWER);     /* Shortest ct, most sensitive to early reads */
+
+    MS5611_PosixQueueInit(&queue);
+    if (MS5611_PosixOs.queueRecv(&queue, &sample, 5) == MS5611_OK) rslt = MS5611_ERROR;
+
+    MS5611_RtosInit(&rtos, &dev, &MS5611_PosixOs, &queue);
+    if (MS5611_PosixStart(&rtos, &thread) != MS5611_OK)
+    {
+        MS5611_PosixQueueDeinit(&queue);
+        return MS5611_ERROR;
+    }
+
+    for (uint32_t i = 0; i < samples && rslt == MS5611_OK; i++)
+    {
+        if (MS5611_RtosRead(&rtos, &sample, 1000) != MS5611_OK) rslt = MS5611_ERROR;
+        else if (sample.data.temperature != MS5611_SIM_TEMP || sample.data.pressure != MS5611_SIM_PRESS) rslt = MS5611_ERROR;
+        else if (i > 0 && (int32_t)(sample.timestamp - prev) <= 0) rslt = MS5611_ERROR;
+        prev = sample.timestamp;
+    }
+
+    rtos.run = 0;
+    pthread_join(thread, NULL);
+    MS5611_PosixQueueDeinit(&queue);
+    if (sim.early != 0 || rtos.errors != 0) rslt = MS5611_ERROR;
+    return rslt;
+#endif
+}
@@ -0,0 +1,81 @@
+/*
+ *  ms5611_rtos_posix.h
+ *
+ *  Created on: Oct 17, 2026
+ *  Author: agent
+ *
+ *  POSIX (pthread) port of the MS5611 RTOS integration layer.
+ *  Lets the task / queue integration run on Linux hosts.
+ *
+ *  Updates and bug reports :  @ https://github.com/Berkin99/MS5611
+ *
+ */
+
+#ifndef MS5611_RTOS_POSIX_H_
+#define MS5611_RTOS_POSIX_H_
+
+#include <pthread.h>
+#include "ms5611_rtos.h"
+
+#ifndef MS5611_POSIX_QUEUE_LEN
+#define MS5611_POSIX_QUEUE_LEN   8
+#endif
+
+typedef struct MS5611_PosixQueue_s
+{
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    MS5611_Sample_t buffer[MS5611_POSIX_QUEUE_LEN];
+    uint8_t head;
+    uint8_t count;              /* When full the oldest sample is dropped */
+}MS5611_PosixQueue_t;
+
+extern const MS5611_OsOps_t MS5611_PosixOs;
+
+/*
+ * @brief Initializes a POSIX sample queue. Receive timeouts run on
+ *        CLOCK_MONOTONIC.
+ *
+ * @param[out] queue : Pointer to the queue.
+ *
+ * @return void
+ */
+void MS5611_PosixQueueInit(MS5611_PosixQueue_t* queue);
+
+/*
+ * @brief Releases the mutex and condition variable of a queue. No thread may
+ *        use the queue anymore (join the task first).
+ *
+ * @param[in] queue : Pointer to the queue.
+ *
+ * @return void
+ */
+void MS5611_PosixQueueDeinit(MS5611_PosixQueue_t* queue);
+
+/*
+ * @brief Runs MS5611_RtosTask in a new thread.
+ *
+ * @param[in]  rtos   : Pointer to the integration structure.
+ * @param[out] thread : Created thread, join it after clearing rtos->run.
+ *
+ * @retval 0 -> Success
+ * @retval > 0 -> Failure
+ */
+int8_t MS5611_PosixStart(MS5611_Rtos_t* rtos, pthread_t* thread);
+
+/*
+ * @brief Self check of the port : runs MS5611_RtosTask in a thread against a
+ *        simulated sensor (ms5611_sim.h on a real clock, an ADC read before
+ *        the conversion time returns 0 like the part)
+ *        and reads the samples back through the queue. Also checks that a
+ *        receive on an empty queue times out, and that the task stops.
+ *
+ * @param[in] samples : Samples to read (>= 1).
+ *
+ * @retval 0 -> Success
+ * @retval > 0 -> Failure : early ADC read, wrong value, lost task or timeout,
+ *                 always with MS5611_STATIC_INTF
+ */
+int8_t MS5611_PosixSelfCheck(uint32_t samples);
+
+#endif /* MS5611_RTOS_POSIX_H_ */
@@ -0,0 +1,117 @@
+/*
+ *  ms5611_shm.c
+ *
+ *  Created on: Oct 17, 2026
+ *  Author: agent
+ *
+ *  MS5611 sample publication through POSIX shared memory (Linux).
+ *
+ *  Updates and bug reports :  @ https://github.com/Berkin99/MS5611
+ *
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include "ms5611_shm.h"
+
+static int8_t MS5611_ShmMap(MS5611_Shm_t* shm, const char* name, int flags, int prot){
+    strncpy(shm->name, name, sizeof(shm->name) - 1);
+    shm->name[sizeof(shm->name) - 1] = '\0';
+
+    shm->fd = shm_open(shm->name, flags, 0644);
+    if (shm->fd < 0) return MS5611_ERROR;
+    if ((flags & O_CREAT) && ftruncate(shm->fd, sizeof(MS5611_ShmRegion_t)) != 0)
+    {
+        close(shm->fd);
+        return MS5611_ERROR;
+    }
+    shm->region = mmap(NULL, sizeof(MS5611_ShmRegion_t), prot, MAP_SHARED, shm->fd, 0);
+    if (shm->region == MAP_FAILED)
+    {
+        shm->region = NULL;
+        close(shm->fd);
+        return MS5611_ERROR;
+    }
+    return MS5611_OK;
+}
+
+int8_t MS5611_ShmCreate(MS5611_Shm_t* shm, const char* name){
+    shm->owner = 1;
+    if (MS5611_ShmMap(shm, name, O_CREAT | O_RDWR, PROT_READ | PROT_WRITE) != MS5611_OK) return MS5611_ERROR;
+
+    shm->region->slots = MS5611_SHM_SLOTS;
+    atomic_store_explicit(&shm->region->head, 0, memory_order_relaxed);
+    for (uint32_t i = 0; i < MS5611_SHM_SLOTS; i++) atomic_store_explicit(&shm->region->ring[i].seq, 0, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    shm->region->magic = MS5611_SHM_MAGIC;
+    return MS5611_OK;
+}
+
+void MS5611_ShmPublish(MS5611_Shm_t* shm, const MS5611_Sample_t* pSample){
+    MS5611_ShmRegion_t* r = shm->region;
+    uint64_t index = atomic_load_explicit(&r->head, memory_order_relaxed);
+    MS5611_ShmSlot_t* slot = &r->ring[index & (MS5611_SHM_SLOTS - 1)];
+
+    atomic_store_explicit(&slot->seq, 2 * index + 1, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    slot->sample = *pSample;
+    atomic_store_explicit(&slot->seq, 2 * (index + 1), memory_order_release);
+    atomic_store_explicit(&r->head, index + 1, memory_order_release);
+}
+
+int8_t MS5611_ShmOpen(MS5611_Shm_t* shm, const char* name){
+    shm->owner = 0;
+    if (MS5611_ShmMap(shm, name, O_RDONLY, PROT_READ) != MS5611_OK) return MS5611_ERROR;
+    if (shm->region->magic != MS5611_SHM_MAGIC || shm->region->slots != MS5611_SHM_SLOTS)
+    {
+        MS5611_ShmClose(shm);
+        return MS5611_ERROR;
+    }
+    return MS5611_OK;
+}
+
+/* Seqlock read of one index, fails when the slot is not (or no longer) that index */
+static int8_t MS5611_ShmSlotRead(const MS5611_ShmRegion_t* r, uint64_t index, MS5611_Sample_t* pSample){
+    const MS5611_ShmSlot_t* slot = &r->ring[index & (MS5611_SHM_SLOTS - 1)];
+    uint64_t expect = 2 * (index + 1);
+
+    if (atomic_load_explicit((_Atomic uint64_t*)&slot->seq, memory_order_acquire) != expect) return MS5611_ERROR;
+    *pSample = slot->sample;
+    atomic_thread_fence(memory_order_acquire);
+    if (atomic_load_explicit((_Atomic uint64_t*)&slot->seq, memory_order_relaxed) != expect) return MS5611_ERROR;
+    return MS5611_OK;
+}
+
+int8_t MS5611_ShmLatest(const MS5611_Shm_t* shm, MS5611_Sample_t* pSample){
+    for (;;)
+    {
+        uint64_t head = atomic_load_explicit((_Atomic uint64_t*)&shm->region->head, memory_order_acquire);
+        if (head == 0) return MS5611_ERROR;
+        if (MS5611_ShmSlotRead(shm->region, head - 1, pSample) == MS5611_OK) return MS5611_OK;
+    }
+}
+
+int8_t MS5611_ShmRead(const MS5611_Shm_t* shm, uint64_t* pCursor, MS5611_Sample_t* pSample){
+    uint64_t head = atomic_load_explicit((_Atomic uint64_t*)&shm->region->head, memory_order_acquire);
+
+    if (*pCursor >= head) return MS5611_BUSY;
+    if (head - *pCursor > MS5611_SHM_SLOTS || MS5611_ShmSlotRead(shm->region, *pCursor, pSample) != MS5611_OK)
+    {
+        /* Oldest index that is not being overwritten by the next publish */
+        *pCursor = (head >= MS5611_SHM_SLOTS) ? head - MS5611_SHM_SLOTS + 1 : 0;
+        return MS5611_SHM_OVERRUN;
+    }
+    (*pCursor)++;
+    return MS5611_OK;
+}
+
+void MS5611_ShmClose(MS5611_Shm_t* shm){
+    if (shm->region != NULL) munmap(shm->region, sizeof(MS5611_ShmRegion_t));
+    close(shm->fd);
+    if (shm->owner) shm_unlink(shm->name);
+    shm->region = NULL;
+}
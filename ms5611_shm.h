@@ -0,0 +1,116 @@
+/*
+ *  ms5611_shm.h
+ *
+ *  Created on: Oct 17, 2026
+ *  Author: agent
+ *
+ *  MS5611 sample publication through POSIX shared memory (Linux).
+ *  One publisher writes timestamped samples into a seqlock ring, any number
+ *  of reader processes map it read-only and read without copies through
+ *  the kernel or syscalls per sample.
+ *
+ *  Updates and bug reports :  @ https://github.com/Berkin99/MS5611
+ *
+ */
+
+#ifndef MS5611_SHM_H_
+#define MS5611_SHM_H_
+
+#include <stdatomic.h>
+#include "ms5611.h"
+
+#ifndef MS5611_SHM_SLOTS
+#define MS5611_SHM_SLOTS      64    /* Ring length, power of two */
+#endif
+
+#define MS5611_SHM_MAGIC      0x4D533131UL
+#define MS5611_SHM_OVERRUN    3     /* Reader fell behind, cursor moved to the oldest sample */
+
+typedef struct MS5611_ShmSlot_s
+{
+    _Atomic uint64_t seq;       /* 2 * (index + 1) when valid, odd while written */
+    MS5611_Sample_t sample;
+}MS5611_ShmSlot_t;
+
+typedef struct MS5611_ShmRegion_s
+{
+    uint32_t magic;
+    uint32_t slots;
+    _Atomic uint64_t head;      /* Published sample count */
+    MS5611_ShmSlot_t ring[MS5611_SHM_SLOTS];
+}MS5611_ShmRegion_t;
+
+typedef struct MS5611_Shm_s
+{
+    MS5611_ShmRegion_t* region;
+    int fd;
+    uint8_t owner;              /* Publisher, unlinks the object on close */
+    char name[64];
+}MS5611_Shm_t;
+
+/*
+ * @brief Creates (or recreates) the shared memory object as publisher.
+ *
+ * @param[out] shm  : Pointer to the handle.
+ * @param[in]  name : Object name, e.g. "/ms5611".
+ *
+ * @retval 0 -> Success
+ * @retval > 0 -> Failure
+ */
+int8_t MS5611_ShmCreate(MS5611_Shm_t* shm, const char* name);
+
+/*
+ * @brief Publishes one sample. Wait-free, never blocks on readers.
+ *
+ * @param[in] shm     : Publisher handle.
+ * @param[in] pSample : Sample.
+ *
+ * @return void
+ */
+void MS5611_ShmPublish(MS5611_Shm_t* shm, const MS5611_Sample_t* pSample);
+
+/*
+ * @brief Maps an existing object read-only as reader.
+ *
+ * @param[out] shm  : Pointer to the handle.
+ * @param[in]  name : Object name.
+ *
+ * @retval 0 -> Success
+ * @retval > 0 -> Failure
+ */
+int8_t MS5611_ShmOpen(MS5611_Shm_t* shm, const char* name);
+
+/*
+ * @brief Reads the latest sample.
+ *
+ * @param[in]  shm     : Reader handle.
+ * @param[out] pSample : Sample.
+ *
+ * @retval 0 -> Success
+ * @retval > 0 -> Nothing published yet
+ */
+int8_t MS5611_ShmLatest(const MS5611_Shm_t* shm, MS5611_Sample_t* pSample);
+
+/*
+ * @brief Reads the next sample after a cursor (start with cursor 0).
+ *
+ * @param[in]     shm     : Reader handle.
+ * @param[in,out] pCursor : Index of the next sample to read.
+ * @param[out]    pSample : Sample.
+ *
+ * @retval 0 -> Success, cursor advanced
+ * @retval 2 -> No new sample (MS5611_BUSY)
+ * @retval 3 -> Overrun, cursor moved to the oldest sample still in the ring
+ */
+int8_t MS5611_ShmRead(const MS5611_Shm_t* shm, uint64_t* pCursor, MS5611_Sample_t* pSample);
+
+/*
+ * @brief Unmaps the object, the publisher also unlinks it.
+ *
+ * @param[in] shm : Handle.
+ *
+ * @return void
+ */
+void MS5611_ShmClose(MS5611_Shm_t* shm);
+
+#endif /* MS5611_SHM_H_ */
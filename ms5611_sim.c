@@ -0,0 +1,117 @@
+/*
+ *  ms5611_sim.c
+ *
+ *  Created on: Oct 17, 2026
+ *  Author: agent
+ *
+ *  MS5611 simulated sensor transport (hosted).
+ *
+ *  Updates and bug reports :  @ https://github.com/Berkin99/MS5611
+ *
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stddef.h>
+#include <time.h>
+#include "ms5611_sim.h"
+
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L)
+#define MS5611_SIM_TLS  _Thread_local
+#elif defined(__GNUC__)
+#define MS5611_SIM_TLS  __thread
+#else
+#define MS5611_SIM_TLS                  /* One simulation at a time */
+#endif
+
+const uint16_t MS5611_SimProm[8] = {0, 40127, 36924, 23317, 23282, 33464, 28312, 0};
+
+static MS5611_SIM_TLS MS5611_Sim_t* simDelayBus;  /* Delay has no instance argument */
+
+uint64_t MS5611_SimNow(const MS5611_Sim_t* sim){
+    struct timespec ts;
+
+    if (sim->mode != MS5611_SIM_REALTIME) return sim->clock;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+void MS5611_SimInit(MS5611_Sim_t* sim, MS5611_SimClock_e mode, MS5611_SimXferNs_t xferNs, const void* xferCtx){
+    sim->mode = mode;
+    sim->xferNs = xferNs;
+    sim->xferCtx = xferCtx;
+    sim->clock = 0;
+    sim->busy = 0;
+    sim->xfers = 0;
+    sim->early = 0;
+    simDelayBus = sim;
+}
+
+void MS5611_SimAttach(MS5611_Sim_t* sim, MS5611_SimPart_t* part){
+    part->bus = sim;
+    part->conv = 0;
+    part->start = 0;
+}
+
+static void MS5611_SimXfer(MS5611_Sim_t* sim, uint8_t rxLen){
+    uint32_t t = (sim->xferNs != NULL) ? sim->xferNs(sim->xferCtx, rxLen) : 0;
+
+    sim->xfers++;
+    sim->busy += t;
+    if (sim->mode != MS5611_SIM_REALTIME) sim->clock += t;
+}
+
+/* Datasheet maximum : 0.6 ms at OSR 256, doubling per OSR step */
+static uint64_t MS5611_SimConvNs(uint8_t conv){
+    return 600000ULL << ((conv & 0x0F) / 2);
+}
+
+static int8_t MS5611_SimRead(void* intf, uint8_t reg, uint8_t* pRxData, uint8_t len){
+    MS5611_SimPart_t* part = (MS5611_SimPart_t*)intf;
+    MS5611_Sim_t* sim = part->bus;
+    uint32_t adc = 0;
+
+    if (reg >= MS5611_CMD_READ_PROM)
+    {
+        uint16_t w = MS5611_SimProm[((reg - MS5611_CMD_READ_PROM) / 2) & 7];
+        for (uint8_t i = 0; i < len && i < 2; i++) pRxData[i] = (uint8_t)(w >> (8 * (1 - i)));
+        MS5611_SimXfer(sim, len);
+        return MS5611_OK;
+    }
+
+    if (sim->mode == MS5611_SIM_INSTANT || MS5611_SimNow(sim) - part->start >= MS5611_SimConvNs(part->conv))
+    {
+        adc = ((part->conv & 0xF0) == MS5611_CMD_CONV_D1) ? MS5611_SIM_D1 : MS5611_SIM_D2;
+    }
+    else sim->early++;
+
+    for (uint8_t i = 0; i < len; i++) pRxData[i] = (uint8_t)(adc >> (8 * (len - 1 - i)));
+    MS5611_SimXfer(sim, len);
+    return MS5611_OK;
+}
+
+static int8_t MS5611_SimWrite(void* intf, uint8_t reg, const uint8_t* pTxData, uint8_t len){
+    MS5611_SimPart_t* part = (MS5611_SimPart_t*)intf;
+
+    (void)pTxData;
+    (void)len;
+    MS5611_SimXfer(part->bus, 0);
+    part->conv = reg;
+    part->start = MS5611_SimNow(part->bus);   /* Conversion starts at the end of the command */
+    return MS5611_OK;
+}
+
+static uint32_t MS5611_SimTimestamp(void* intf){
+    return (uint32_t)(MS5611_SimNow(((MS5611_SimPart_t*)intf)->bus) / 1000ULL);
+}
+
+static void MS5611_SimDelay(uint32_t ms){
+    if (simDelayBus != NULL && simDelayBus->mode != MS5611_SIM_REALTIME) simDelayBus->clock += (uint64_t)ms * 1000000ULL;
+}
+
+const MS5611_Ops_t MS5611_SimOps = {
+    .read = MS5611_SimRead,
+    .write = MS5611_SimWrite,
+    .timestamp = MS5611_SimTimestamp,
+    .delay = MS5611_SimDelay
+};
@@ -0,0 +1,106 @@
+/*
+ *  ms5611_sim.h
+ *
+ *  Created on: Oct 17, 2026
+ *  Author: agent
+ *
+ *  MS5611 simulated sensor transport (hosted), shared by the self checks and
+ *  models (ms5611_model.h, ms5611_bench.h, ms5611_rtos_posix.h). Not part of
+ *  a target build.
+ *
+ *  One bus carries any number of simulated parts. Each part answers with the
+ *  datasheet example PROM and raw values (T = 20.07 C, P = 1000.09 mbar).
+ *  A conversion takes the datasheet maximum time (0.6 ms at OSR 256,
+ *  doubling per OSR step), an ADC read before its end returns 0 like the
+ *  part and is counted in early.
+ *
+ *  Clocks :
+ *      MS5611_SIM_VIRTUAL  : ns counter advanced by the modeled transfer
+ *                            times and by the delay op of MS5611_SimOps.
+ *      MS5611_SIM_INSTANT  : virtual clock, conversions end at once
+ *                            (zero latency transport).
+ *      MS5611_SIM_REALTIME : CLOCK_MONOTONIC. The delay op does not sleep,
+ *                            use a copy of MS5611_SimOps with a real delay.
+ *
+ *  The delay op has no instance argument : it advances the bus last
+ *  initialized by MS5611_SimInit in the calling thread.
+ *
+ *  Updates and bug reports :  @ https://github.com/Berkin99/MS5611
+ *
+ */
+
+#ifndef MS5611_SIM_H_
+#define MS5611_SIM_H_
+
+#include "ms5611.h"
+
+#define MS5611_SIM_D1         9085466UL     /* Datasheet example raw pressure */
+#define MS5611_SIM_D2         8569150UL     /* Datasheet example raw temperature */
+#define MS5611_SIM_TEMP       2007          /* Compensated result (centi-degC) */
+#define MS5611_SIM_PRESS      100009        /* Compensated result (Pa) */
+
+typedef enum
+{
+    MS5611_SIM_VIRTUAL = 0,
+    MS5611_SIM_INSTANT,
+    MS5611_SIM_REALTIME
+}MS5611_SimClock_e;
+
+typedef uint32_t (*MS5611_SimXferNs_t)(const void* ctx, uint8_t rxLen);    /* Transaction time, rxLen bytes after the command */
+
+typedef struct MS5611_Sim_s
+{
+    MS5611_SimClock_e mode;
+    MS5611_SimXferNs_t xferNs;  /* NULL for zero time transfers */
+    const void* xferCtx;
+    uint64_t clock;             /* Virtual time (ns) */
+    uint64_t busy;              /* Time spent in transfers (ns) */
+    uint32_t xfers;             /* Transactions */
+    uint32_t early;             /* ADC reads before the conversion end */
+}MS5611_Sim_t;
+
+typedef struct MS5611_SimPart_s
+{
+    MS5611_Sim_t* bus;
+    uint8_t conv;               /* Last conversion command */
+    uint64_t start;             /* Conversion start (ns) */
+}MS5611_SimPart_t;
+
+extern const uint16_t MS5611_SimProm[8];
+
+/* Interface : MS5611_SimPart_t */
+extern const MS5611_Ops_t MS5611_SimOps;
+
+/*
+ * @brief Initializes a simulated bus and binds it to the delay op of the
+ *        calling thread.
+ *
+ * @param[out] sim     : Pointer to the bus.
+ * @param[in]  mode    : Clock.
+ * @param[in]  xferNs  : Transaction time model, NULL for zero time.
+ * @param[in]  xferCtx : Argument of xferNs.
+ *
+ * @return void
+ */
+void MS5611_SimInit(MS5611_Sim_t* sim, MS5611_SimClock_e mode, MS5611_SimXferNs_t xferNs, const void* xferCtx);
+
+/*
+ * @brief Puts a simulated part on the bus, its address is the device intf.
+ *
+ * @param[in]  sim  : Pointer to the bus.
+ * @param[out] part : Pointer to the part.
+ *
+ * @return void
+ */
+void MS5611_SimAttach(MS5611_Sim_t* sim, MS5611_SimPart_t* part);
+
+/*
+ * @brief Current time of the bus clock.
+ *
+ * @param[in] sim : Pointer to the bus.
+ *
+ * @return uint64_t  : Nanoseconds.
+ */
+uint64_t MS5611_SimNow(const MS5611_Sim_t* sim);
+
+#endif /* MS5611_SIM_H_ */
@@ -0,0 +1,339 @@
+/*
+ *  ms5611_stream.c
+ *
+ *  Created on: Oct 17, 2026
+ *  Author: agent
+ *
+ *  MS5611 telemetry streamer over loopback UDP or Unix datagram sockets (Linux).
+ *
+ *  Updates and bug reports :  @ https://github.com/Berkin99/MS5611
+ *
+ */
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <poll.h>
+#include <sys/un.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include "ms5611_stream.h"
+
+static void MS5611_Put32(uint8_t* p, uint32_t v){
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+}
+
+static uint32_t MS5611_Get32(const uint8_t* p){
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static void MS5611_RecordEncode(uint8_t* p, const MS5611_Sample_t* pSample){
+    MS5611_Put32(&p[0], pSample->timestamp);
+    MS5611_Put32(&p[4], pSample->D1);
+    MS5611_Put32(&p[8], pSample->D2);
+    MS5611_Put32(&p[12], (uint32_t)pSample->data.temperature);
+    MS5611_Put32(&p[16], (uint32_t)pSample->data.pressure);
+}
+
+uint32_t MS5611_FrameEncode(uint8_t* pFrame, uint32_t seq, const MS5611_Sample_t* pSamples, uint8_t count){
+    pFrame[0] = (uint8_t)MS5611_STREAM_MAGIC;
+    pFrame[1] = (uint8_t)(MS5611_STREAM_MAGIC >> 8);
+    pFrame[2] = MS5611_STREAM_VERSION;
+    pFrame[3] = count;
+    MS5611_Put32(&pFrame[4], seq);
+
+    for (uint8_t i = 0; i < count; i++)
+    {
+        MS5611_RecordEncode(pFrame + MS5611_STREAM_HEADER + (size_t)i * MS5611_STREAM_RECORD, &pSamples[i]);
+    }
+    return MS5611_STREAM_HEADER + (uint32_t)count * MS5611_STREAM_RECORD;
+}
+
+int16_t MS5611_FrameDecode(const uint8_t* pFrame, uint32_t len, uint32_t* pSeq, MS5611_Sample_t* pSamples){
+    const uint8_t* p = pFrame + MS5611_STREAM_HEADER;
+    uint8_t count;
+
+    if (len < MS5611_STREAM_HEADER) return -1;
+    count = pFrame[3];
+    if ((pFrame[0] | (pFrame[1] << 8)) != MS5611_STREAM_MAGIC || pFrame[2] != MS5611_STREAM_VERSION) return -1;
+    if (count > MS5611_STREAM_BATCH_MAX || len != MS5611_STREAM_HEADER + (uint32_t)count * MS5611_STREAM_RECORD) return -1;
+
+    *pSeq = MS5611_Get32(&pFrame[4]);
+    for (uint8_t i = 0; i < count; i++, p += MS5611_STREAM_RECORD)
+    {
+        pSamples[i].timestamp = MS5611_Get32(&p[0]);
+        pSamples[i].D1 = MS5611_Get32(&p[4]);
+        pSamples[i].D2 = MS5611_Get32(&p[8]);
+        pSamples[i].data.temperature = (int32_t)MS5611_Get32(&p[12]);
+        pSamples[i].data.pressure = (int32_t)MS5611_Get32(&p[16]);
+    }
+    return count;
+}
+
+static void MS5611_StreamReset(MS5611_Stream_t* stream){
+    stream->batch = MS5611_STREAM_BATCH_MAX;
+    stream->fill = 0;
+    stream->frames = 0;
+    stream->seq = 0;
+}
+
+int8_t MS5611_StreamOpenUdp(MS5611_Stream_t* stream, uint16_t port){
+    struct sockaddr_in* in = (struct sockaddr_in*)&stream->dest;
+
+    MS5611_StreamReset(stream);
+    memset(&stream->dest, 0, sizeof(stream->dest));
+    in->sin_family = AF_INET;
+    in->sin_port = htons(port);
+    in->sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    stream->destLen = sizeof(*in);
+    stream->fd = socket(AF_INET, SOCK_DGRAM, 0);
+    return (stream->fd < 0) ? MS5611_ERROR : MS5611_OK;
+}
+
+int8_t MS5611_StreamOpenUnix(MS5611_Stream_t* stream, const char* path){
+    struct sockaddr_un* un = (struct sockaddr_un*)&stream->dest;
+
+    if (strlen(path) >= sizeof(un->sun_path)) return MS5611_ERROR;
+    MS5611_StreamReset(stream);
+    memset(&stream->dest, 0, sizeof(stream->dest));
+    un->sun_family = AF_UNIX;
+    strcpy(un->sun_path, path);
+    stream->destLen = sizeof(*un);
+    stream->fd = socket(AF_UNIX, SOCK_DGRAM, 0);
+    return (stream->fd < 0) ? MS5611_ERROR : MS5611_OK;
+}
+
+/* Sends the complete frames plus the first `partial` samples of the open one */
+static int8_t MS5611_StreamSend(MS5611_Stream_t* stream, uint8_t partial){
+    struct mmsghdr msg[MS5611_STREAM_FRAMES];
+    struct iovec iov[MS5611_STREAM_FRAMES];
+    uint8_t n = stream->frames + (partial ? 1 : 0);
+    uint8_t sent = 0;
+
+    for (uint8_t i = 0; i < n; i++)
+    {
+        uint8_t count = (i < stream->frames) ? stream->batch : partial;
+        uint8_t* frame = stream->buffer[i];
+
+        frame[3] = count;
+        iov[i].iov_base = frame;
+        iov[i].iov_len = MS5611_STREAM_HEADER + (size_t)count * MS5611_STREAM_RECORD;
+        memset(&msg[i], 0, sizeof(msg[i]));
+        msg[i].msg_hdr.msg_name = &stream->dest;
+        msg[i].msg_hdr.msg_namelen = stream->destLen;
+        msg[i].msg_hdr.msg_iov = &iov[i];
+        msg[i].msg_hdr.msg_iovlen = 1;
+    }
+    while (sent < n)
+    {
+        int r = sendmmsg(stream->fd, &msg[sent], n - sent, 0);
+        if (r <= 0) break;
+        sent += (uint8_t)r;
+    }
+    stream->frames = 0;
+    stream->fill = 0;
+    return (sent == n) ? MS5611_OK : MS5611_ERROR;
+}
+
+int8_t MS5611_StreamPush(MS5611_Stream_t* stream, const MS5611_Sample_t* pSample){
+    uint8_t* frame = stream->buffer[stream->frames];
+
+    if (stream->fill == 0) MS5611_FrameEncode(frame, stream->seq++, NULL, 0);
+    MS5611_RecordEncode(frame + MS5611_STREAM_HEADER + (size_t)stream->fill * MS5611_STREAM_RECORD, pSample);
+
+    if (++stream->fill < stream->batch) return MS5611_OK;
+    stream->fill = 0;
+    if (++stream->frames < MS5611_STREAM_FRAMES) return MS5611_OK;
+    return MS5611_StreamSend(stream, 0);
+}
+
+int8_t MS5611_StreamFlush(MS5611_Stream_t* stream){
+    if (stream->frames == 0 && stream->fill == 0) return MS5611_OK;
+    return MS5611_StreamSend(stream, stream->fill);
+}
+
+int8_t MS5611_StreamSetBatch(MS5611_Stream_t* stream, uint8_t batch){
+    int8_t rslt;
+
+    if (batch == 0 || batch > MS5611_STREAM_BATCH_MAX) return MS5611_ERROR;
+    rslt = MS5611_StreamFlush(stream);
+    stream->batch = batch;
+    return rslt;
+}
+
+void MS5611_StreamClose(MS5611_Stream_t* stream){
+    MS5611_StreamFlush(stream);
+    close(stream->fd);
+    stream->fd = -1;
+}
+
+int8_t MS5611_ReceiverOpenUdp(MS5611_Receiver_t* rx, uint16_t port){
+    struct sockaddr_in in;
+
+    memset(&in, 0, sizeof(in));
+    in.sin_family = AF_INET;
+    in.sin_port = htons(port);
+    in.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    rx->seq = 0;
+    rx->lost = 0;
+    rx->started = 0;
+    rx->path[0] = '\0';
+    rx->fd = socket(AF_INET, SOCK_DGRAM, 0);
+    if (rx->fd < 0) return MS5611_ERROR;
+    if (bind(rx->fd, (struct sockaddr*)&in, sizeof(in)) != 0)
+    {
+        close(rx->fd);
+        return MS5611_ERROR;
+    }
+    return MS5611_OK;
+}
+
+int8_t MS5611_ReceiverOpenUnix(MS5611_Receiver_t* rx, const char* path){
+    struct sockaddr_un un;
+
+    if (strlen(path) >= sizeof(un.sun_path)) return MS5611_ERROR;
+    memset(&un, 0, sizeof(un));
+    un.sun_family = AF_UNIX;
+    strcpy(un.sun_path, path);
+    strcpy(rx->path, path);
+    rx->seq = 0;
+    rx->lost = 0;
+    rx->started = 0;
+    unlink(path);
+    rx->fd = socket(AF_UNIX, SOCK_DGRAM, 0);
+    if (rx->fd < 0) return MS5611_ERROR;
+    if (bind(rx->fd, (struct sockaddr*)&un, sizeof(un)) != 0)
+    {
+        close(rx->fd);
+        return MS5611_ERROR;
+    }
+    return MS5611_OK;
+}
+
+int16_t MS5611_ReceiverRecv(MS5611_Receiver_t* rx, MS5611_Sample_t* pSamples, int32_t timeout){
+    struct pollfd pfd = { .fd = rx->fd, .events = POLLIN };
+    uint32_t seq;
+    ssize_t len;
+    int16_t count;
+
+    if (timeout >= 0)
+    {
+        int r = poll(&pfd, 1, timeout);
+        if (r == 0) return 0;
+        if (r < 0) return -1;
+    }
+    len = recv(rx->fd, rx->buffer, sizeof(rx->buffer), 0);
+    if (len < 0) return -1;
+
+    count = MS5611_FrameDecode(rx->buffer, (uint32_t)len, &seq, pSamples);
+    if (count < 0) return -1;
+
+    /* First frame seeds the sequence, a backwards step is a sender restart */
+    if (rx->started && (int32_t)(seq - rx->seq) > 0) rx->lost += seq - rx->seq;
+    rx->started = 1;
+    rx->seq = seq + 1;
+    return count;
+}
+
+void MS5611_ReceiverClose(MS5611_Receiver_t* rx){
+    close(rx->fd);
+    rx->fd = -1;
+    if (rx->path[0] != '\0') unlink(rx->path);
+}
+
+static uint64_t MS5611_StreamNs(void){
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/* Receives everything pending, waits up to timeout for the first frame */
+static uint32_t MS5611_StreamDrain(MS5611_Receiver_t* rx, MS5611_Sample_t* pSamples, int32_t timeout){
+    uint32_t n = 0;
+    int16_t count;
+
+    while ((count = MS5611_ReceiverRecv(rx, pSamples, timeout)) > 0)
+    {
+        n += (uint32_t)count;
+        timeout = 0;
+    }
+    return n;
+}
+
+static int8_t MS5611_StreamBenchOne(MS5611_Stream_t* stream, MS5611_Receiver_t* rx, const char* transport, uint8_t batch, uint32_t samples, FILE* report){
+    MS5611_Sample_t rxSamples[MS5611_STREAM_BATCH_MAX];
+    MS5611_Sample_t sample = { 0 };
+    uint32_t received = 0;
+    uint32_t frames = stream->seq;
+    uint64_t start, elapsed;
+    int8_t rslt = MS5611_StreamSetBatch(stream, batch);
+
+    start = MS5611_StreamNs();
+    for (uint32_t i = 0; i < samples && rslt == MS5611_OK; i++)
+    {
+        sample.timestamp = i;
+        sample.D1 = 9085466U + (i & 0xFFU);
+        sample.D2 = 8569150U;
+        sample.data.temperature = 2007;
+        sample.data.pressure = 100009 + (int32_t)(i & 0xFFU);
+        rslt = MS5611_StreamPush(stream, &sample);
+
+        /* Single thread : empty the socket after every sendmmsg */
+        if (stream->fill == 0 && stream->frames == 0) received += MS5611_StreamDrain(rx, rxSamples, 0);
+    }
+    if (rslt == MS5611_OK) rslt = MS5611_StreamFlush(stream);
+    while (received < samples)
+    {
+        uint32_t n = MS5611_StreamDrain(rx, rxSamples, 100);
+        if (n == 0) break;
+        received += n;
+    }
+    elapsed = MS5611_StreamNs() - start;
+    frames = stream->seq - frames;
+
+    fprintf(report,
+            "{\"transport\":\"%s\",\"batch\":%u,\"samples\":%lu,\"received\":%lu,\"frames\":%lu,\"lost\":%lu,"
+            "\"bytes\":%lu,\"ns_per_sample\":%.1f,\"samples_per_s\":%.0f,\"rslt\":%d}\n",
+            transport, (unsigned)batch, (unsigned long)samples, (unsigned long)received, (unsigned long)frames,
+            (unsigned long)rx->lost, (unsigned long)(frames * MS5611_STREAM_HEADER + received * MS5611_STREAM_RECORD),
+            (double)elapsed / samples, samples * 1e9 / (double)elapsed, rslt);
+
+    return (rslt == MS5611_OK && received == samples) ? MS5611_OK : MS5611_ERROR;
+}
+
+int8_t MS5611_StreamBench(uint16_t port, const char* path, uint32_t samples, FILE* report){
+    static MS5611_Stream_t stream;
+    static MS5611_Receiver_t rx;
+    int8_t rslt = MS5611_OK;
+
+    if (samples == 0) return MS5611_ERROR;
+
+    for (uint8_t t = 0; t < 2; t++)
+    {
+        if (t == 0 && port == 0) continue;
+        if (t == 1 && path == NULL) continue;
+
+        if ((t == 0) ? MS5611_ReceiverOpenUdp(&rx, port) : MS5611_ReceiverOpenUnix(&rx, path)) return MS5611_ERROR;
+        if ((t == 0) ? MS5611_StreamOpenUdp(&stream, port) : MS5611_StreamOpenUnix(&stream, path))
+        {
+            MS5611_ReceiverClose(&rx);
+            return MS5611_ERROR;
+        }
+        for (uint8_t batch = 1; batch <= MS5611_STREAM_BATCH_MAX && batch != 0; batch <<= 1)
+        {
+            rx.lost = 0;
+            rslt |= MS5611_StreamBenchOne(&stream, &rx, (t == 0) ? "udp" : "unix", batch, samples, report);
+        }
+        MS5611_StreamClose(&stream);
+        MS5611_ReceiverClose(&rx);
+    }
+    return rslt;
+}
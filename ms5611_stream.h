@@ -0,0 +1,190 @@
+/*
+ *  ms5611_stream.h
+ *
+ *  Created on: Oct 17, 2026
+ *  Author: agent
+ *
+ *  MS5611 telemetry streamer over loopback UDP or Unix datagram sockets (Linux).
+ *  N timestamped samples are packed into one binary frame, full frames are
+ *  sent together with sendmmsg. The batch size trades latency for throughput,
+ *  MS5611_StreamBench measures it on loopback.
+ *
+ *  Frame (little endian) :
+ *      u16 magic 0x3556, u8 version, u8 count, u32 sequence,
+ *      count * { u32 timestamp, u32 D1, u32 D2, i32 temperature, i32 pressure }
+ *
+ *  Updates and bug reports :  @ https://github.com/Berkin99/MS5611
+ *
+ */
+
+#ifndef MS5611_STREAM_H_
+#define MS5611_STREAM_H_
+
+#include <stdio.h>
+#include <sys/socket.h>
+#include "ms5611.h"
+
+#define MS5611_STREAM_MAGIC       0x3556
+#define MS5611_STREAM_VERSION     1
+#define MS5611_STREAM_HEADER      8
+#define MS5611_STREAM_RECORD      20
+
+#ifndef MS5611_STREAM_BATCH_MAX
+#define MS5611_STREAM_BATCH_MAX   64    /* Samples per frame */
+#endif
+#ifndef MS5611_STREAM_FRAMES
+#define MS5611_STREAM_FRAMES      8     /* Frames per sendmmsg */
+#endif
+
+#define MS5611_STREAM_FRAME_MAX   (MS5611_STREAM_HEADER + MS5611_STREAM_BATCH_MAX * MS5611_STREAM_RECORD)
+
+typedef struct MS5611_Stream_s
+{
+    int fd;
+    struct sockaddr_storage dest;
+    socklen_t destLen;
+    uint8_t batch;                  /* Samples per frame */
+    uint8_t fill;                   /* Samples in the current frame */
+    uint8_t frames;                 /* Complete frames waiting for sendmmsg */
+    uint32_t seq;
+    uint8_t buffer[MS5611_STREAM_FRAMES][MS5611_STREAM_FRAME_MAX];
+}MS5611_Stream_t;
+
+typedef struct MS5611_Receiver_s
+{
+    int fd;
+    uint32_t seq;                   /* Next expected sequence */
+    uint32_t lost;                  /* Frames missing in the sequence, from the first frame received */
+    uint8_t started;                /* A frame was received, seq is valid */
+    char path[108];                 /* Unix socket path, removed on close */
+    uint8_t buffer[MS5611_STREAM_FRAME_MAX];
+}MS5611_Receiver_t;
+
+/*
+ * @brief Packs samples into a frame.
+ *
+ * @param[out] pFrame   : Frame buffer, MS5611_STREAM_HEADER + count * MS5611_STREAM_RECORD bytes.
+ * @param[in]  seq      : Frame sequence number.
+ * @param[in]  pSamples : Samples.
+ * @param[in]  count    : Number of samples.
+ *
+ * @return uint32_t  : Frame length.
+ */
+uint32_t MS5611_FrameEncode(uint8_t* pFrame, uint32_t seq, const MS5611_Sample_t* pSamples, uint8_t count);
+
+/*
+ * @brief Unpacks a frame.
+ *
+ * @param[in]  pFrame   : Frame.
+ * @param[in]  len      : Frame length.
+ * @param[out] pSeq     : Frame sequence number.
+ * @param[out] pSamples : Samples, room for MS5611_STREAM_BATCH_MAX.
+ *
+ * @return int16_t  : Number of samples, -1 on a malformed frame.
+ */
+int16_t MS5611_FrameDecode(const uint8_t* pFrame, uint32_t len, uint32_t* pSeq, MS5611_Sample_t* pSamples);
+
+/*
+ * @brief Opens a streamer to a loopback UDP port or a Unix datagram path.
+ *
+ * @param[out] stream : Pointer to the streamer.
+ * @param[in]  port   : UDP port on 127.0.0.1 (OpenUdp).
+ * @param[in]  path   : Receiver socket path (OpenUnix).
+ *
+ * @retval 0 -> Success
+ * @retval > 0 -> Failure
+ */
+int8_t MS5611_StreamOpenUdp(MS5611_Stream_t* stream, uint16_t port);
+int8_t MS5611_StreamOpenUnix(MS5611_Stream_t* stream, const char* path);
+
+/*
+ * @brief Sets the samples per frame. Pending samples are flushed first.
+ *
+ * @param[in] stream : Pointer to the streamer.
+ * @param[in] batch  : 1 .. MS5611_STREAM_BATCH_MAX.
+ *
+ * @retval 0 -> Success
+ * @retval > 0 -> Failure
+ */
+int8_t MS5611_StreamSetBatch(MS5611_Stream_t* stream, uint8_t batch);
+
+/*
+ * @brief Appends a sample, frames go out when MS5611_STREAM_FRAMES are complete.
+ *
+ * @param[in] stream  : Pointer to the streamer.
+ * @param[in] pSample : Sample.
+ *
+ * @retval 0 -> Success
+ * @retval > 0 -> Send failure
+ */
+int8_t MS5611_StreamPush(MS5611_Stream_t* stream, const MS5611_Sample_t* pSample);
+
+/*
+ * @brief Sends complete frames and the partially filled one.
+ *
+ * @param[in] stream : Pointer to the streamer.
+ *
+ * @retval 0 -> Success
+ * @retval > 0 -> Send failure
+ */
+int8_t MS5611_StreamFlush(MS5611_Stream_t* stream);
+
+/*
+ * @brief Flushes and closes the streamer.
+ *
+ * @param[in] stream : Pointer to the streamer.
+ *
+ * @return void
+ */
+void MS5611_StreamClose(MS5611_Stream_t* stream);
+
+/*
+ * @brief Binds a receiver to a loopback UDP port or a Unix datagram path.
+ *
+ * @param[out] rx   : Pointer to the receiver.
+ * @param[in]  port : UDP port on 127.0.0.1 (OpenUdp).
+ * @param[in]  path : Socket path, replaced if it exists (OpenUnix).
+ *
+ * @retval 0 -> Success
+ * @retval > 0 -> Failure
+ */
+int8_t MS5611_ReceiverOpenUdp(MS5611_Receiver_t* rx, uint16_t port);
+int8_t MS5611_ReceiverOpenUnix(MS5611_Receiver_t* rx, const char* path);
+
+/*
+ * @brief Receives one frame, blocking up to timeout.
+ *
+ * @param[in]  rx       : Pointer to the receiver.
+ * @param[out] pSamples : Samples, room for MS5611_STREAM_BATCH_MAX.
+ * @param[in]  timeout  : Milliseconds, negative to block.
+ *
+ * @return int16_t  : Number of samples, 0 on timeout, -1 on error.
+ */
+int16_t MS5611_ReceiverRecv(MS5611_Receiver_t* rx, MS5611_Sample_t* pSamples, int32_t timeout);
+
+/*
+ * @brief Closes the receiver.
+ *
+ * @param[in] rx : Pointer to the receiver.
+ *
+ * @return void
+ */
+void MS5611_ReceiverClose(MS5611_Receiver_t* rx);
+
+/*
+ * @brief Loopback throughput benchmark. Streams samples to a receiver in the
+ *        same thread for batch 1, 2, 4 .. MS5611_STREAM_BATCH_MAX and writes
+ *        one JSON line per (transport, batch) : frames, bytes, lost frames,
+ *        ns per sample and samples per second.
+ *
+ * @param[in] port    : UDP port on 127.0.0.1, 0 to skip UDP.
+ * @param[in] path    : Unix socket path, NULL to skip Unix.
+ * @param[in] samples : Samples per run.
+ * @param[in] report  : Report output.
+ *
+ * @retval 0 -> Success, every sample received
+ * @retval > 0 -> Failure
+ */
+int8_t MS5611_StreamBench(uint16_t port, const char* path, uint32_t samples, FILE* report);
+
+#endif /* MS5611_STREAM_H_ */
@@ -0,0 +1,207 @@
+/*
+ *  ms5611_trace.c
+ *
+ *  Created on: Oct 17, 2026
+ *  Author: agent
+ *
+ *  MS5611 bus transcript record and replay transport (hosted, stdio).
+ *
+ *  Updates and bug reports :  @ https://github.com/Berkin99/MS5611
+ *
+ */
+
+#include <stddef.h>
+#include "ms5611_trace.h"
+
+#define MS5611_TRACE_WRITEREAD  0x01    /* Header op mask */
+#define MS5611_TRACE_TRANSFER   0x02
+#define MS5611_TRACE_SUBMIT     0x04
+#define MS5611_TRACE_TIMESTAMP  0x08
+
+#ifndef MS5611_STATIC_INTF
+
+static void MS5611_TraceLog(MS5611_Trace_t* trace, char kind, int8_t rslt, uint8_t cmd, const uint8_t* pData, uint8_t len){
+    uint32_t ts = (trace->inner->timestamp != NULL) ? trace->inner->timestamp(trace->intf) : 0;
+
+    fprintf(trace->file, "%c %lu %d %02X %u%s", kind, (unsigned long)ts, rslt, cmd, len, (len && pData) ? " " : "");
+    for (uint8_t i = 0; pData && i < len; i++) fprintf(trace->file, "%02X", pData[i]);
+    fputc('\n', trace->file);
+    trace->count++;
+}
+
+static int8_t MS5611_TraceRecordRead(void* intf, uint8_t reg, uint8_t* pRxData, uint8_t len){
+    MS5611_Trace_t* trace = (MS5611_Trace_t*)intf;
+    int8_t rslt = trace->inner->read(trace->intf, reg, pRxData, len);
+
+    MS5611_TraceLog(trace, 'R', rslt, reg, pRxData, len);
+    return rslt;
+}
+
+static int8_t MS5611_TraceRecordWrite(void* intf, uint8_t reg, const uint8_t* pTxData, uint8_t len){
+    MS5611_Trace_t* trace = (MS5611_Trace_t*)intf;
+    int8_t rslt = trace->inner->write(trace->intf, reg, pTxData, len);
+
+    MS5611_TraceLog(trace, 'W', rslt, reg, pTxData, len);
+    return rslt;
+}
+
+/* The driver sends a single command byte, it is logged as cmd */
+static int8_t MS5611_TraceRecordWriteRead(void* intf, const uint8_t* pTxData, uint8_t txLen, uint8_t* pRxData, uint8_t rxLen){
+    MS5611_Trace_t* trace = (MS5611_Trace_t*)intf;
+    int8_t rslt = trace->inner->writeRead(trace->intf, pTxData, txLen, pRxData, rxLen);
+
+    MS5611_TraceLog(trace, 'Q', rslt, pTxData[0], pRxData, rxLen);
+    return rslt;
+}
+
+static int8_t MS5611_TraceRecordTransfer(void* intf, const uint8_t* pTxData, uint8_t* pRxData, uint8_t len){
+    MS5611_Trace_t* trace = (MS5611_Trace_t*)intf;
+    int8_t rslt = trace->inner->transfer(trace->intf, pTxData, pRxData, len);
+
+    MS5611_TraceLog(trace, 'T', rslt, pTxData[0], pRxData, len);
+    return rslt;
+}
+
+/* Forwarded from a copy, items addressed to the trace are retargeted to the recorded instance */
+static int8_t MS5611_TraceRecordSubmit(void* intf, const MS5611_Xfer_t* pXfer, uint8_t count){
+    MS5611_Trace_t* trace = (MS5611_Trace_t*)intf;
+    MS5611_Xfer_t x[UINT8_MAX];
+    int8_t rslt;
+
+    for (uint8_t i = 0; i < count; i++)
+    {
+        x[i] = pXfer[i];
+        if (x[i].intf == intf) x[i].intf = trace->intf;
+    }
+    rslt = trace->inner->submit(trace->intf, x, count);
+    for (uint8_t i = 0; i < count; i++) MS5611_TraceLog(trace, 'S', rslt, x[i].cmd, x[i].pRxData, x[i].len);
+    return rslt;
+}
+
+static uint32_t MS5611_TraceRecordTimestamp(void* intf){
+    MS5611_Trace_t* trace = (MS5611_Trace_t*)intf;
+    return trace->inner->timestamp(trace->intf);
+}
+
+/* Next transcript line, must match kind / command / length. Returns the recorded result. */
+static int8_t MS5611_TraceNext(MS5611_Trace_t* trace, char kind, uint8_t cmd, uint8_t* pData, uint8_t len){
+    char k;
+    unsigned long ts;
+    int rslt;
+    unsigned int c, n, b;
+
+    if (trace->error) return MS5611_ERROR;
+    if (fscanf(trace->file, " %c %lu %d %x %u", &k, &ts, &rslt, &c, &n) != 5 || k != kind || c != cmd || n != len)
+    {
+        trace->error = 1;
+        return MS5611_ERROR;
+    }
+    for (uint8_t i = 0; pData && i < len; i++)
+    {
+        if (fscanf(trace->file, "%2x", &b) != 1)
+        {
+            trace->error = 1;
+            return MS5611_ERROR;
+        }
+        if (kind != 'W') pData[i] = (uint8_t)b;
+    }
+    trace->timestamp = (uint32_t)ts;
+    trace->count++;
+    return (int8_t)rslt;
+}
+
+static int8_t MS5611_TraceReplayRead(void* intf, uint8_t reg, uint8_t* pRxData, uint8_t len){
+    return MS5611_TraceNext((MS5611_Trace_t*)intf, 'R', reg, pRxData, len);
+}
+
+static int8_t MS5611_TraceReplayWrite(void* intf, uint8_t reg, const uint8_t* pTxData, uint8_t len){
+    uint8_t skip[256];
+    return MS5611_TraceNext((MS5611_Trace_t*)intf, 'W', reg, pTxData ? skip : NULL, len);
+}
+
+static int8_t MS5611_TraceReplayWriteRead(void* intf, const uint8_t* pTxData, uint8_t txLen, uint8_t* pRxData, uint8_t rxLen){
+    (void)txLen;
+    return MS5611_TraceNext((MS5611_Trace_t*)intf, 'Q', pTxData[0], pRxData, rxLen);
+}
+
+static int8_t MS5611_TraceReplayTransfer(void* intf, const uint8_t* pTxData, uint8_t* pRxData, uint8_t len){
+    return MS5611_TraceNext((MS5611_Trace_t*)intf, 'T', pTxData[0], pRxData, len);
+}
+
+static int8_t MS5611_TraceReplaySubmit(void* intf, const MS5611_Xfer_t* pXfer, uint8_t count){
+    int8_t rslt = MS5611_OK;
+    for (uint8_t i = 0; i < count; i++) rslt = MS5611_TraceNext((MS5611_Trace_t*)intf, 'S', pXfer[i].cmd, pXfer[i].pRxData, pXfer[i].len);
+    return rslt;
+}
+
+static uint32_t MS5611_TraceReplayTimestamp(void* intf){
+    return ((MS5611_Trace_t*)intf)->timestamp;
+}
+
+static void MS5611_TraceReplayDelay(uint32_t ms){
+    (void)ms;
+}
+
+#endif /* MS5611_STATIC_INTF */
+
+int8_t MS5611_TraceRecord(MS5611_Trace_t* trace, FILE* file, void* intf, const MS5611_Ops_t* ops){
+#ifdef MS5611_STATIC_INTF
+    (void)trace; (void)file; (void)intf; (void)ops;
+    return MS5611_ERROR;        /* The device has no ops table to wrap */
+#else
+    MS5611_Ops_t record = {
+        .read = MS5611_TraceRecordRead,
+        .write = MS5611_TraceRecordWrite,
+        .writeRead = ops->writeRead ? MS5611_TraceRecordWriteRead : NULL,
+        .transfer = ops->transfer ? MS5611_TraceRecordTransfer : NULL,
+        .submit = ops->submit ? MS5611_TraceRecordSubmit : NULL,
+        .timestamp = ops->timestamp ? MS5611_TraceRecordTimestamp : NULL,
+        .delay = ops->delay
+    };
+    trace->file = file;
+    trace->intf = intf;
+    trace->inner = ops;
+    trace->ops = record;
+    trace->timestamp = 0;
+    trace->count = 0;
+    trace->error = 0;
+
+    /* Op set header : replay takes the same driver paths */
+    fprintf(file, "O %X\n", (ops->writeRead ? MS5611_TRACE_WRITEREAD : 0) |
+                            (ops->transfer ? MS5611_TRACE_TRANSFER : 0) |
+                            (ops->submit ? MS5611_TRACE_SUBMIT : 0) |
+                            (ops->timestamp ? MS5611_TRACE_TIMESTAMP : 0));
+    return MS5611_OK;
+#endif
+}
+
+int8_t MS5611_TraceReplay(MS5611_Trace_t* trace, FILE* file){
+#ifdef MS5611_STATIC_INTF
+    (void)trace; (void)file;
+    return MS5611_ERROR;        /* The device has no ops table to replace */
+#else
+    unsigned int mask = 0;
+    int c = fgetc(file);
+
+    if (c == 'O') { if (fscanf(file, " %x", &mask) != 1) mask = 0; }
+    else if (c != EOF) ungetc(c, file);
+
+    MS5611_Ops_t replay = {
+        .read = MS5611_TraceReplayRead,
+        .write = MS5611_TraceReplayWrite,
+        .writeRead = (mask & MS5611_TRACE_WRITEREAD) ? MS5611_TraceReplayWriteRead : NULL,
+        .transfer = (mask & MS5611_TRACE_TRANSFER) ? MS5611_TraceReplayTransfer : NULL,
+        .submit = (mask & MS5611_TRACE_SUBMIT) ? MS5611_TraceReplaySubmit : NULL,
+        .timestamp = (mask & MS5611_TRACE_TIMESTAMP) ? MS5611_TraceReplayTimestamp : NULL,
+        .delay = MS5611_TraceReplayDelay
+    };
+    trace->file = file;
+    trace->intf = NULL;
+    trace->inner = NULL;
+    trace->ops = replay;
+    trace->timestamp = 0;
+    trace->count = 0;
+    trace->error = 0;
+    return MS5611_OK;
+#endif
+}
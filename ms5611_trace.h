@@ -0,0 +1,74 @@
+/*
+ *  ms5611_trace.h
+ *
+ *  Created on: Oct 17, 2026
+ *  Author: agent
+ *
+ *  MS5611 bus transcript record and replay transport (hosted, stdio).
+ *  Record : wraps a real transport, every transfer is forwarded and
+ *           logged with its result, command, length, payload and timestamp.
+ *  Replay : feeds a transcript back to the driver without hardware, with
+ *           the recorded results, delays return immediately so runs are
+ *           deterministic.
+ *
+ *  Transcript format (text) : an op set header, then one transfer per line
+ *      O <mask hex>                    writeRead 1, transfer 2, submit 4, timestamp 8
+ *      <K> <timestamp us> <rslt> <cmd hex> <len> [payload hex]
+ *  K : R read, W write, Q writeRead, T transfer (full frame), S submit item.
+ *  Replay offers the same optional ops as the recorded transport, so the
+ *  driver takes the same bus path (a transport without a clock is replayed
+ *  without one). writeRead is logged with its first tx byte. Submit items
+ *  addressed to other interface instances are forwarded unchanged, the
+ *  caller's transfer list is not modified.
+ *  Not available with MS5611_STATIC_INTF, the device has no ops table.
+ *
+ *  Updates and bug reports :  @ https://github.com/Berkin99/MS5611
+ *
+ */
+
+#ifndef MS5611_TRACE_H_
+#define MS5611_TRACE_H_
+
+#include <stdio.h>
+#include "ms5611.h"
+
+typedef struct MS5611_Trace_s
+{
+    FILE* file;
+    void* intf;                 /* Recorded transport instance, NULL on replay */
+    const MS5611_Ops_t* inner;  /* Recorded transport, NULL on replay */
+    MS5611_Ops_t ops;           /* Ops table to pass to MS5611_NewDevice */
+    uint32_t timestamp;         /* Timestamp of the last replayed transfer */
+    uint32_t count;             /* Transfers recorded / replayed */
+    uint8_t error;              /* Replay mismatch or end of transcript */
+}MS5611_Trace_t;
+
+/*
+ * @brief Starts recording a real transport into a transcript file.
+ *        Create the device with MS5611_NewDevice(trace, &trace->ops).
+ *
+ * @param[out] trace : Pointer to the trace structure.
+ * @param[in]  file  : Transcript file opened for writing.
+ * @param[in]  intf  : Real interface instance.
+ * @param[in]  ops   : Real transport operations.
+ *
+ * @retval 0 -> Success
+ * @retval > 0 -> Failure (MS5611_STATIC_INTF build)
+ */
+int8_t MS5611_TraceRecord(MS5611_Trace_t* trace, FILE* file, void* intf, const MS5611_Ops_t* ops);
+
+/*
+ * @brief Starts replaying a transcript file.
+ *        Create the device with MS5611_NewDevice(trace, &trace->ops).
+ *        Every transfer must match the next transcript line (kind, command,
+ *        length), otherwise it fails and trace->error is set.
+ *
+ * @param[out] trace : Pointer to the trace structure.
+ * @param[in]  file  : Transcript file opened for reading.
+ *
+ * @retval 0 -> Success
+ * @retval > 0 -> Failure (MS5611_STATIC_INTF build)
+ */
+int8_t MS5611_TraceReplay(MS5611_Trace_t* trace, FILE* file);
+
+#endif /* MS5611_TRACE_H_ */
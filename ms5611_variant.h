@@ -0,0 +1,119 @@
+/*
+ *  ms5611_variant.h
+ *
+ *  Created on: Oct 17, 2026
+ *  Author: agent
+ *
+ *  MS5611 internal : per variant compensation descriptor and kernel
+ *  selection. Shared by the driver and the benchmark reference model, not
+ *  part of the public API.
+ *
+ *  Updates and bug reports :  @ https://github.com/Berkin99/MS5611
+ *
+ */
+
+#ifndef MS5611_VARIANT_H_
+#define MS5611_VARIANT_H_
+
+#include "ms5611.h"
+
+/*
+ * Variant compensation descriptors (datasheet shifts and second order terms).
+ *   SENS = C1 * 2^SENS_SH + C3 * dT / 2^TCS_SH
+ *   OFF  = C2 * 2^OFF_SH  + C4 * dT / 2^TCO_SH
+ *   T < 20C   : T2 = T2L * dT^2 / 2^T2L_SH, OFF2 = OFF2L * (T-2000)^2 / 2^OFF2L_SH,
+ *               SENS2 = SENS2L * (T-2000)^2 / 2^SENS2L_SH
+ *   T < -15C  : OFF2 += OFF2V * (T+1500)^2, SENS2 += SENS2V * (T+1500)^2 / 2^SENS2V_SH
+ *   T >= HOT  : T2 = T2H * dT^2 / 2^T2H_SH, SENS2 = SENS2H * (T-HOT)^2 / 2^SENS2H_SH
+ */
+#if (MS5611_VARIANT == MS5611_VARIANT_MS5611)
+#define V_SENS_SH 15
+#define V_TCS_SH  8
+#define V_OFF_SH  16
+#define V_TCO_SH  7
+#define V_T2L     1
+#define V_T2L_SH  31
+#define V_OFF2L   5
+#define V_OFF2L_SH 1
+#define V_SENS2L  5
+#define V_SENS2L_SH 2
+#define V_OFF2V   7
+#define V_SENS2V  11
+#define V_SENS2V_SH 1
+#define V_HOT     2000
+#define V_T2H     0
+#define V_T2H_SH  0
+#define V_SENS2H  0
+#define V_SENS2H_SH 0
+#elif (MS5611_VARIANT == MS5611_VARIANT_MS5607)
+#define V_SENS_SH 16
+#define V_TCS_SH  7
+#define V_OFF_SH  17
+#define V_TCO_SH  6
+#define V_T2L     1
+#define V_T2L_SH  31
+#define V_OFF2L   61
+#define V_OFF2L_SH 4
+#define V_SENS2L  2
+#define V_SENS2L_SH 0
+#define V_OFF2V   15
+#define V_SENS2V  8
+#define V_SENS2V_SH 0
+#define V_HOT     2000
+#define V_T2H     0
+#define V_T2H_SH  0
+#define V_SENS2H  0
+#define V_SENS2H_SH 0
+#elif (MS5611_VARIANT == MS5611_VARIANT_MS5637)
+#define V_SENS_SH 16
+#define V_TCS_SH  7
+#define V_OFF_SH  17
+#define V_TCO_SH  6
+#define V_T2L     3
+#define V_T2L_SH  33
+#define V_OFF2L   61
+#define V_OFF2L_SH 4
+#define V_SENS2L  29
+#define V_SENS2L_SH 4
+#define V_OFF2V   17
+#define V_SENS2V  9
+#define V_SENS2V_SH 0
+#define V_HOT     2000
+#define V_CRC_W0  1       /* CRC in word 0 bits 15..12, 7 word PROM */
+#define V_T2H     5
+#define V_T2H_SH  38
+#define V_SENS2H  0
+#define V_SENS2H_SH 0
+#elif (MS5611_VARIANT == MS5611_VARIANT_MS5803_01BA)
+#define V_SENS_SH 15
+#define V_TCS_SH  8
+#define V_OFF_SH  16
+#define V_TCO_SH  7
+#define V_T2L     1
+#define V_T2L_SH  31
+#define V_OFF2L   3
+#define V_OFF2L_SH 0
+#define V_SENS2L  7
+#define V_SENS2L_SH 3
+#define V_OFF2V   0
+#define V_SENS2V  2
+#define V_SENS2V_SH 0
+#define V_HOT     4500
+#define V_T2H     0
+#define V_T2H_SH  0
+#define V_SENS2H  (-1)
+#define V_SENS2H_SH 3
+#else
+#error "MS5611_VARIANT : unknown part"
+#endif
+
+#ifndef V_CRC_W0
+#define V_CRC_W0  0       /* CRC in word 7 bits 3..0 */
+#endif
+
+/* MS5611_RawDataProcess runs the float kernel, otherwise it routes to MS5611_RawDataProcessInt */
+#if !defined(MS5611_WCET) && !defined(MS5611_MINIMAL) && (MS5611_VARIANT == MS5611_VARIANT_MS5611)
+#define MS5611_FLOAT_KERNEL
+#endif
+
+#endif /* MS5611_VARIANT_H_ */
@@ -0,0 +1,106 @@
+/*
+ *  ms5611_vario.c
+ *
+ *  Created on: Oct 17, 2026
+ *  Author: agent
+ *
+ *  MS5611 variometer : streaming pressure-rate estimator.
+ *
+ *  Updates and bug reports :  @ https://github.com/Berkin99/MS5611
+ *
+ */
+
+#include <math.h>
+#include "ms5611_vario.h"
+
+#define MS5611_RD           287.05f     /* Dry air gas constant J/(kg K) */
+#define MS5611_G0           9.80665f
+
+int8_t MS5611_VarioInit(MS5611_Vario_t* vario, uint8_t window){
+    if (window < 3 || window > MS5611_VARIO_MAX) return MS5611_ERROR;
+    vario->window = window;
+    vario->n = 0;
+    vario->head = 0;
+    vario->since = 0;
+    vario->St = vario->Stt = vario->Sp = vario->Stp = vario->Spp = 0.0f;
+    return MS5611_OK;
+}
+
+static void MS5611_VarioRebuild(MS5611_Vario_t* v){
+    uint8_t oldest = (uint8_t)((v->head + v->window - v->n) % v->window);
+
+    v->origin = v->ts[oldest];
+    v->p0 = v->p[oldest];
+    v->St = v->Stt = v->Sp = v->Stp = v->Spp = 0.0f;
+    for (uint8_t i = 0; i < v->n; i++)
+    {
+        uint8_t k = (uint8_t)((oldest + i) % v->window);
+        float t = (float)(v->ts[k] - v->origin) * 1e-6f;
+        float p = (float)(v->p[k] - v->p0);
+        v->St += t;
+        v->Stt += t * t;
+        v->Sp += p;
+        v->Stp += t * p;
+        v->Spp += p * p;
+    }
+    v->since = 0;
+}
+
+int8_t MS5611_VarioUpdate(MS5611_Vario_t* vario, const MS5611_Sample_t* pSample, MS5611_VarioOut_t* pOut){
+    MS5611_Vario_t* v = vario;
+    float t, p, n, sxx, sxy, syy, slope, sse, kelvin, scale;
+
+    if (v->n == 0)
+    {
+        v->origin = pSample->timestamp;
+        v->p0 = pSample->data.pressure;
+    }
+
+    /* Remove the sample that leaves the window */
+    if (v->n == v->window)
+    {
+        float to = (float)(v->ts[v->head] - v->origin) * 1e-6f;
+        float po = (float)(v->p[v->head] - v->p0);
+        v->St -= to;
+        v->Stt -= to * to;
+        v->Sp -= po;
+        v->Stp -= to * po;
+        v->Spp -= po * po;
+        v->n--;
+    }
+
+    t = (float)(pSample->timestamp - v->origin) * 1e-6f;
+    p = (float)(pSample->data.pressure - v->p0);
+    v->ts[v->head] = pSample->timestamp;
+    v->p[v->head] = pSample->data.pressure;
+    v->head = (uint8_t)((v->head + 1) % v->window);
+    v->n++;
+    v->St += t;
+    v->Stt += t * t;
+    v->Sp += p;
+    v->Stp += t * p;
+    v->Spp += p * p;
+
+    if (++v->since >= v->window) MS5611_VarioRebuild(v);
+    if (v->n < v->window) return MS5611_BUSY;
+
+    n = (float)v->n;
+    sxx = v->Stt - v->St * v->St / n;
+    sxy = v->Stp - v->St * v->Sp / n;
+    syy = v->Spp - v->Sp * v->Sp / n;
+    if (sxx <= 0.0f) return MS5611_BUSY;
+
+    slope = sxy / sxx;
+    sse = syy - slope * sxy;
+    if (sse < 0.0f) sse = 0.0f;
+
+    /* Hypsometric : dh = -(Rd * T / (g * P)) dP */
+    kelvin = (float)pSample->data.temperature * 0.01f + 273.15f;
+    scale = MS5611_RD * kelvin / (MS5611_G0 * (float)pSample->data.pressure);
+
+    pOut->dPdt = slope;
+    pOut->climb = -slope * scale;
+    pOut->sigma = sqrtf(sse / ((n - 2.0f) * sxx)) * scale;
+    pOut->confidence = 1.0f / (1.0f + pOut->sigma / MS5611_VARIO_SIGMA_REF);
+    return MS5611_OK;
+}
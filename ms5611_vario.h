@@ -0,0 +1,73 @@
+/*
+ *  ms5611_vario.h
+ *
+ *  Created on: Oct 17, 2026
+ *  Author: agent
+ *
+ *  MS5611 variometer : streaming pressure-rate estimator.
+ *  Least squares line over a sliding window of timestamped samples, kept as
+ *  running sums so each update is O(1) (the sums are rebuilt from the ring
+ *  once per window to stop float drift). With evenly spaced samples this is
+ *  the first order Savitzky-Golay derivative; uneven timestamps are handled.
+ *  The estimate refers to the window center : latency is half the window.
+ *
+ *  Updates and bug reports :  @ https://github.com/Berkin99/MS5611
+ *
+ */
+
+#ifndef MS5611_VARIO_H_
+#define MS5611_VARIO_H_
+
+#include "ms5611.h"
+
+#ifndef MS5611_VARIO_MAX
+#define MS5611_VARIO_MAX          32      /* Largest window */
+#endif
+
+#define MS5611_VARIO_SIGMA_REF    0.1f    /* Climb std. error (m/s) where confidence is 0.5 */
+
+typedef struct MS5611_VarioOut_s
+{
+    float dPdt;                 /* Pa/s */
+    float climb;                /* m/s, positive up */
+    float sigma;                /* Standard error of climb (m/s) */
+    float confidence;           /* 1 / (1 + sigma / MS5611_VARIO_SIGMA_REF) */
+}MS5611_VarioOut_t;
+
+typedef struct MS5611_Vario_s
+{
+    uint32_t ts[MS5611_VARIO_MAX];  /* Timestamps (us) */
+    int32_t p[MS5611_VARIO_MAX];    /* Pressure (Pa) */
+    uint8_t window;
+    uint8_t n;
+    uint8_t head;                   /* Next slot */
+    uint8_t since;                  /* Updates since the last rebuild */
+    uint32_t origin;                /* Time origin of the sums (us) */
+    int32_t p0;                     /* Pressure origin of the sums (Pa) */
+    float St, Stt, Sp, Stp, Spp;
+}MS5611_Vario_t;
+
+/*
+ * @brief Initializes the estimator.
+ *
+ * @param[out] vario  : Pointer to the estimator.
+ * @param[in]  window : Samples in the fit, 3 .. MS5611_VARIO_MAX.
+ *
+ * @retval 0 -> Success
+ * @retval > 0 -> Failure
+ */
+int8_t MS5611_VarioInit(MS5611_Vario_t* vario, uint8_t window);
+
+/*
+ * @brief Adds a sample and updates the estimate.
+ *
+ * @param[in]  vario   : Pointer to the estimator.
+ * @param[in]  pSample : Sample with timestamp (us) and data.
+ * @param[out] pOut    : Estimate.
+ *
+ * @retval 0 -> Success
+ * @retval 2 -> Window not filled yet (MS5611_BUSY)
+ */
+int8_t MS5611_VarioUpdate(MS5611_Vario_t* vario, const MS5611_Sample_t* pSample, MS5611_VarioOut_t* pOut);
+
+#endif /* MS5611_VARIO_H_ */
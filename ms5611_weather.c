@@ -0,0 +1,151 @@
+/*
+ *  ms5611_weather.c
+ *
+ *  Created on: Oct 17, 2026
+ *  Author: agent
+ *
+ *  MS5611 weather station mode.
+ *
+ *  Updates and bug reports :  @ https://github.com/Berkin99/MS5611
+ *
+ */
+
+#include <math.h>
+#include <stddef.h>
+#include "ms5611_weather.h"
+
+static const uint32_t windowSeconds[MS5611_WX_WINDOWS] = {
+    [MS5611_WX_1MIN] = 60,
+    [MS5611_WX_1HOUR] = 3600,
+    [MS5611_WX_24HOUR] = 86400,
+};
+
+static void MS5611_WxClear(MS5611_WxBucket_t* b){
+    b->min = INT32_MAX;
+    b->max = INT32_MIN;
+    b->sum = 0;
+    b->count = 0;
+}
+
+static void MS5611_WxMerge(MS5611_WxBucket_t* acc, const MS5611_WxBucket_t* b){
+    if (b->count == 0) return;
+    if (b->min < acc->min) acc->min = b->min;
+    if (b->max > acc->max) acc->max = b->max;
+    acc->sum += b->sum;
+    acc->count += b->count;
+}
+
+int8_t MS5611_WeatherInit(MS5611_Weather_t* ws, float altitude, uint8_t mask, uint8_t samplesPerBucket){
+    uint32_t shortest = 0;
+
+    if (mask == 0 || samplesPerBucket == 0) return MS5611_ERROR;
+
+    for (uint8_t w = 0; w < MS5611_WX_WINDOWS; w++)
+    {
+        for (uint8_t i = 0; i < MS5611_WX_BUCKETS; i++) MS5611_WxClear(&ws->ring[w].bucket[i]);
+        ws->ring[w].head = 0;
+        ws->ring[w].ema = 0.0f;
+        if ((mask & MS5611_WX_MASK(w)) && shortest == 0) shortest = windowSeconds[w];
+    }
+    ws->mask = mask;
+    ws->started = 0;
+    ws->hours = 0;
+    ws->interval = shortest / MS5611_WX_BUCKETS / samplesPerBucket;
+    if (ws->interval == 0) ws->interval = 1;
+    ws->qnhFactor = powf(1.0f - 0.0065f * altitude / 288.15f, -5.25588f);
+    return MS5611_OK;
+}
+
+void MS5611_WeatherAdd(MS5611_Weather_t* ws, uint32_t now, const MS5611_Data_t* data){
+    int32_t p = data->pressure;
+
+    for (uint8_t w = 0; w < MS5611_WX_WINDOWS; w++)
+    {
+        MS5611_WxRing_t* r = &ws->ring[w];
+        uint32_t period = windowSeconds[w] / MS5611_WX_BUCKETS;
+        MS5611_WxBucket_t* b;
+
+        if (!(ws->mask & MS5611_WX_MASK(w))) continue;
+
+        if (!ws->started)
+        {
+            r->start = now;
+            r->lastSample = now;
+            r->ema = (float)p;
+        }
+
+        /* Close elapsed buckets, gaps longer than the window clear it */
+        for (uint8_t k = 0; (now - r->start) >= period && k <= MS5611_WX_BUCKETS; k++)
+        {
+            r->head = (uint8_t)((r->head + 1) % MS5611_WX_BUCKETS);
+            r->start += period;
+
+            /* Hourly means for the tendency : the full ring before it wraps */
+            if (w == MS5611_WX_1HOUR && r->head == 0)
+            {
+                MS5611_WxBucket_t acc;
+                MS5611_WxClear(&acc);
+                for (uint8_t i = 0; i < MS5611_WX_BUCKETS; i++) MS5611_WxMerge(&acc, &r->bucket[i]);
+                if (acc.count != 0)
+                {
+                    for (uint8_t i = 3; i > 0; i--) ws->hourly[i] = ws->hourly[i - 1];
+                    ws->hourly[0] = (int32_t)(acc.sum / acc.count);
+                    if (ws->hours < 4) ws->hours++;
+                }
+                else ws->hours = 0;     /* Empty hour : the tendency waits for 4 contiguous hours again */
+            }
+            MS5611_WxClear(&r->bucket[r->head]);
+        }
+        if ((now - r->start) >= period)
+        {
+            r->start = now;
+            if (w == MS5611_WX_1HOUR) ws->hours = 0;    /* Hours skipped without closing */
+        }
+
+        b = &r->bucket[r->head];
+        if (p < b->min) b->min = p;
+        if (p > b->max) b->max = p;
+        b->sum += p;
+        b->count++;
+
+        /* Irregular sampling safe EMA, tau = window length */
+        r->ema += (1.0f - expf(-(float)(now - r->lastSample) / (float)windowSeconds[w])) * ((float)p - r->ema);
+        r->lastSample = now;
+    }
+    ws->started = 1;
+}
+
+int8_t MS5611_WeatherStats(const MS5611_Weather_t* ws, MS5611_WxWindow_e window, MS5611_WxStats_t* pStats){
+    MS5611_WxBucket_t acc;
+
+    if (window >= MS5611_WX_WINDOWS || !(ws->mask & MS5611_WX_MASK(window))) return MS5611_ERROR;
+
+    MS5611_WxClear(&acc);
+    for (uint8_t i = 0; i < MS5611_WX_BUCKETS; i++) MS5611_WxMerge(&acc, &ws->ring[window].bucket[i]);
+    if (acc.count == 0) return MS5611_ERROR;
+
+    pStats->min = acc.min;
+    pStats->max = acc.max;
+    pStats->mean = (int32_t)(acc.sum / acc.count);
+    pStats->ema = (int32_t)lroundf(ws->ring[window].ema);
+    pStats->count = acc.count;
+    return MS5611_OK;
+}
+
+int32_t MS5611_WeatherQNH(const MS5611_Weather_t* ws, int32_t pressure){
+    return (int32_t)lroundf((float)pressure * ws->qnhFactor);
+}
+
+MS5611_Tendency_e MS5611_WeatherTendency(const MS5611_Weather_t* ws, int32_t* pDelta){
+    int32_t delta;
+
+    if (ws->hours < 4) return MS5611_TEND_UNKNOWN;
+    delta = ws->hourly[0] - ws->hourly[3];
+    if (pDelta != NULL) *pDelta = delta;
+
+    if (delta <= -350) return MS5611_TEND_FALLING_FAST;
+    if (delta < -100) return MS5611_TEND_FALLING;
+    if (delta >= 350) return MS5611_TEND_RISING_FAST;
+    if (delta > 100) return MS5611_TEND_RISING;
+    return MS5611_TEND_STEADY;
+}
@@ -0,0 +1,141 @@
+/*
+ *  ms5611_weather.h
+ *
+ *  Created on: Oct 17, 2026
+ *  Author: agent
+ *
+ *  MS5611 weather station mode.
+ *  Rolling min / max / mean and an exponential moving average over
+ *  1 minute, 1 hour and 24 hours in constant memory (each window is a ring
+ *  of MS5611_WX_BUCKETS aggregate buckets), QNH from the station altitude
+ *  and the 3 hour pressure tendency class.
+ *  The sensor only has to be woken every ws->interval seconds, derived
+ *  from the shortest enabled window.
+ *
+ *  Updates and bug reports :  @ https://github.com/Berkin99/MS5611
+ *
+ */
+
+#ifndef MS5611_WEATHER_H_
+#define MS5611_WEATHER_H_
+
+#include "ms5611.h"
+
+#define MS5611_WX_BUCKETS     12
+
+typedef enum
+{
+    MS5611_WX_1MIN = 0,
+    MS5611_WX_1HOUR,
+    MS5611_WX_24HOUR,
+    MS5611_WX_WINDOWS
+}MS5611_WxWindow_e;
+
+#define MS5611_WX_MASK(w)     (1U << (w))
+
+typedef enum
+{
+    MS5611_TEND_UNKNOWN = 0,    /* Less than 3 hours of contiguous history */
+    MS5611_TEND_FALLING_FAST,   /* <= -3.5 hPa / 3 h */
+    MS5611_TEND_FALLING,        /* <  -1.0 hPa / 3 h */
+    MS5611_TEND_STEADY,
+    MS5611_TEND_RISING,         /* >   1.0 hPa / 3 h */
+    MS5611_TEND_RISING_FAST     /* >=  3.5 hPa / 3 h */
+}MS5611_Tendency_e;
+
+typedef struct MS5611_WxBucket_s
+{
+    int32_t min;
+    int32_t max;
+    int64_t sum;
+    uint32_t count;
+}MS5611_WxBucket_t;
+
+typedef struct MS5611_WxStats_s
+{
+    int32_t min;                /* Pa */
+    int32_t max;                /* Pa */
+    int32_t mean;               /* Pa */
+    int32_t ema;                /* Pa, time constant = window length */
+    uint32_t count;             /* Samples in the window */
+}MS5611_WxStats_t;
+
+typedef struct MS5611_WxRing_s
+{
+    MS5611_WxBucket_t bucket[MS5611_WX_BUCKETS];
+    uint32_t start;             /* Start of the current bucket (s) */
+    uint32_t lastSample;        /* EMA time base (s) */
+    uint8_t head;
+    float ema;
+}MS5611_WxRing_t;
+
+typedef struct MS5611_Weather_s
+{
+    MS5611_WxRing_t ring[MS5611_WX_WINDOWS];
+    uint8_t mask;               /* Enabled windows */
+    uint8_t started;
+    uint32_t interval;          /* Seconds between samples */
+    float qnhFactor;            /* QNH = QFE * qnhFactor */
+    int32_t hourly[4];          /* Hourly means, [0] newest, for the tendency */
+    uint8_t hours;              /* Valid entries in hourly[] */
+}MS5611_Weather_t;
+
+/*
+ * @brief Initializes the weather station statistics.
+ *
+ * @param[out] ws               : Pointer to the station.
+ * @param[in]  altitude         : Station altitude (m) for QNH.
+ * @param[in]  mask             : Enabled windows, MS5611_WX_MASK(...) ORed.
+ *                                The tendency needs MS5611_WX_1HOUR.
+ * @param[in]  samplesPerBucket : Samples per bucket of the shortest enabled window.
+ *
+ * @retval 0 -> Success
+ * @retval > 0 -> Failure
+ */
+int8_t MS5611_WeatherInit(MS5611_Weather_t* ws, float altitude, uint8_t mask, uint8_t samplesPerBucket);
+
+/*
+ * @brief Adds a sample. Call it every ws->interval seconds.
+ *
+ * @param[in] ws   : Pointer to the station.
+ * @param[in] now  : Time (s), monotonic.
+ * @param[in] data : Sample.
+ *
+ * @return void
+ */
+void MS5611_WeatherAdd(MS5611_Weather_t* ws, uint32_t now, const MS5611_Data_t* data);
+
+/*
+ * @brief Statistics of one window.
+ *
+ * @param[in]  ws     : Pointer to the station.
+ * @param[in]  window : Window.
+ * @param[out] pStats : Statistics.
+ *
+ * @retval 0 -> Success
+ * @retval > 0 -> Window disabled or empty
+ */
+int8_t MS5611_WeatherStats(const MS5611_Weather_t* ws, MS5611_WxWindow_e window, MS5611_WxStats_t* pStats);
+
+/*
+ * @brief Reduces a station pressure to mean sea level (ISA, QNH).
+ *
+ * @param[in] ws       : Pointer to the station.
+ * @param[in] pressure : Station pressure (Pa).
+ *
+ * @return int32_t  : QNH (Pa).
+ */
+int32_t MS5611_WeatherQNH(const MS5611_Weather_t* ws, int32_t pressure);
+
+/*
+ * @brief 3 hour pressure tendency, from 4 contiguous hourly means. A gap
+ *        that leaves an hour empty restarts the history.
+ *
+ * @param[in]  ws     : Pointer to the station.
+ * @param[out] pDelta : Change over 3 hours (Pa), may be NULL.
+ *
+ * @return MS5611_Tendency_e  : Tendency class.
+ */
+MS5611_Tendency_e MS5611_WeatherTendency(const MS5611_Weather_t* ws, int32_t* pDelta);
+
+#endif /* MS5611_WEATHER_H_ */